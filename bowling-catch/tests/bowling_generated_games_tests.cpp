@@ -0,0 +1,26 @@
+#include "bowling.hpp"
+#include "bowling_game_generator.hpp"
+#include "packed_bowling_game.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("Score of generated games is the same as of the packed scorer", "[score][generated]")
+{
+    BowlingGameGenerator generator{2024};
+
+    for (int i = 0; i < 10'000; ++i)
+    {
+        const auto rolls = generator.next_game();
+
+        BowlingGame game;
+        PackedBowlingGame packed_game;
+
+        for (auto pins : rolls)
+        {
+            game.roll(pins);
+            REQUIRE(packed_game.roll(pins) == BowlingErrc::ok);
+        }
+
+        REQUIRE(game.score() == packed_game.score());
+    }
+}
@@ -0,0 +1,130 @@
+#include "bowling_analysis.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <numeric>
+
+using namespace ::testing;
+
+namespace
+{
+    void roll_many(CheckedBowlingGame& game, unsigned int count, unsigned int pins)
+    {
+        for (auto i = 0u; i < count; ++i)
+            ASSERT_EQ(game.roll(pins), BowlingErrc::ok);
+    }
+
+    PinfallModel always(bool knocks_all_pins)
+    {
+        PinfallModel::Probabilities probabilities{};
+
+        for (unsigned int standing = 1; standing <= PinfallModel::max_pins; ++standing)
+            probabilities[standing][knocks_all_pins ? standing : 0] = 1.0;
+
+        return PinfallModel{probabilities};
+    }
+
+    // plain recursion over every possible continuation of the game
+    double expected_score(const CheckedBowlingGame& game)
+    {
+        if (game.is_over())
+            return game.score();
+
+        double result = 0.0;
+
+        for (unsigned int pins = 0; pins <= game.pins_standing(); ++pins)
+        {
+            CheckedBowlingGame next = game;
+            next.roll(pins);
+            result += expected_score(next) / (game.pins_standing() + 1);
+        }
+
+        return result;
+    }
+} // namespace
+
+TEST(BowlingAnalysis, NewGameScoresFromZeroToPerfectGame)
+{
+    auto outlook = analyze_game(CheckedBowlingGame{});
+
+    ASSERT_EQ(outlook.min_score, 0);
+    ASSERT_EQ(outlook.max_score, 300);
+}
+
+TEST(BowlingAnalysis, MaxScoreAssumesOnlyStrikesFromNowOn)
+{
+    CheckedBowlingGame game;
+    roll_many(game, 1, 7);
+
+    auto outlook = analyze_game(game);
+
+    ASSERT_EQ(outlook.min_score, 7);
+    ASSERT_EQ(outlook.max_score, 290);
+}
+
+TEST(BowlingAnalysis, FinishedGameHasOnlyItsScore)
+{
+    CheckedBowlingGame game;
+    roll_many(game, 20, 4);
+
+    auto outlook = analyze_game(game);
+
+    ASSERT_EQ(outlook.min_score, 80);
+    ASSERT_EQ(outlook.max_score, 80);
+    ASSERT_DOUBLE_EQ(outlook.probability(80), 1.0);
+}
+
+TEST(BowlingAnalysis, DistributionFollowsPinfallModel)
+{
+    ASSERT_DOUBLE_EQ(analyze_game(CheckedBowlingGame{}, always(true)).probability(300), 1.0);
+    ASSERT_DOUBLE_EQ(analyze_game(CheckedBowlingGame{}, always(false)).probability(0), 1.0);
+}
+
+TEST(BowlingAnalysis, DistributionSumsToOne)
+{
+    CheckedBowlingGame game;
+    roll_many(game, 3, 10);
+
+    auto outlook = analyze_game(game);
+
+    ASSERT_NEAR(std::accumulate(outlook.distribution.begin(), outlook.distribution.end(), 0.0), 1.0, 1e-9);
+    ASSERT_DOUBLE_EQ(outlook.probability(outlook.min_score - 1), 0.0);
+    ASSERT_GT(outlook.probability(outlook.max_score), 0.0);
+    ASSERT_EQ(outlook.distribution.size(), outlook.max_score + 1);
+}
+
+TEST(BowlingAnalysis, ExpectedScoreMatchesEnumerationOfAllContinuations)
+{
+    CheckedBowlingGame game;
+    roll_many(game, 14, 3);
+    roll_many(game, 1, 10);
+    roll_many(game, 1, 6);
+
+    ASSERT_NEAR(analyze_game(game).expected_score(), expected_score(game), 1e-9);
+}
+
+TEST(PinfallModel, RowsMustBeDistributions)
+{
+    PinfallModel::Probabilities probabilities{};
+
+    ASSERT_THROW(PinfallModel{probabilities}, std::invalid_argument);
+
+    for (unsigned int standing = 1; standing <= PinfallModel::max_pins; ++standing)
+        probabilities[standing][0] = 1.0;
+    probabilities[3][4] = 0.5;
+
+    ASSERT_THROW(PinfallModel{probabilities}, std::invalid_argument);
+}
+
+TEST(PinfallModel, IsBuiltFromHistoricalRolls)
+{
+    std::array<std::array<unsigned int, PinfallModel::max_pins + 1>, PinfallModel::max_pins + 1> counts{};
+    counts[10][10] = 3;
+    counts[10][8] = 1;
+
+    auto model = PinfallModel::from_history(counts);
+
+    ASSERT_DOUBLE_EQ(model.probability(10, 10), 0.75);
+    ASSERT_DOUBLE_EQ(model.probability(10, 8), 0.25);
+    ASSERT_DOUBLE_EQ(model.probability(2, 1), 1.0 / 3);
+}
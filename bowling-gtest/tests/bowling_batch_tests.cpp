@@ -0,0 +1,79 @@
+#include "bowling_batch.hpp"
+#include "bowling_game.hpp"
+#include "packed_bowling_game.hpp"
+#include "random_games.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace ::testing;
+using namespace TestHelpers;
+
+TEST(BowlingGameBatch, ScoresExampleGames)
+{
+    BowlingGameBatch batch(5);
+
+    batch.set_rolls(0, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+    batch.set_rolls(1, {10, 3, 6, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+    batch.set_rolls(2, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 5, 5});
+    batch.set_rolls(3, {1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 10});
+    batch.set_rolls(4, {10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10});
+
+    ASSERT_THAT(batch.score(1), ElementsAre(20, 44, 38, 119, 300));
+}
+
+TEST(BowlingGameBatch, GamesWithoutRollsScoreZero)
+{
+    BowlingGameBatch batch(3);
+
+    ASSERT_THAT(batch.score(), ElementsAre(0, 0, 0));
+}
+
+TEST(BowlingGameBatch, TooManyRollsThrowAnException)
+{
+    BowlingGameBatch batch(1);
+    std::vector<unsigned int> rolls(22, 1);
+
+    ASSERT_THROW(batch.set_rolls(0, rolls), std::length_error);
+}
+
+TEST(BowlingGameBatch, AcceptsPackedGames)
+{
+    PackedBowlingGame packed;
+    for (auto pins : {10u, 7u, 3u, 9u, 0u, 10u, 0u, 8u, 8u, 2u, 0u, 6u, 10u, 10u, 10u, 8u, 1u})
+        packed.roll(pins);
+
+    BowlingGameBatch batch(2);
+    batch.set_rolls(1, packed);
+
+    ASSERT_THAT(batch.score(), ElementsAre(0, 167));
+}
+
+struct BowlingGameBatch_RandomGames : TestWithParam<size_t>
+{
+};
+
+TEST_P(BowlingGameBatch_RandomGames, MatchesBowlingGameScore)
+{
+    const size_t thread_count = GetParam();
+    const size_t game_count = 5'000;
+
+    BowlingGameGenerator games{665};
+    BowlingGameBatch batch(game_count);
+    std::vector<unsigned int> expected_scores;
+
+    for (size_t game = 0; game < game_count; ++game)
+    {
+        auto rolls = games.next_game();
+        if (game % 7 == 0)
+            rolls.resize(rolls.size() / 2); // game in progress
+
+        batch.set_rolls(game, rolls);
+        expected_scores.push_back(score_of(rolls));
+    }
+
+    ASSERT_EQ(batch.score(thread_count), expected_scores);
+}
+
+INSTANTIATE_TEST_SUITE_P(ThreadCounts, BowlingGameBatch_RandomGames, Values(1u, 3u, 8u));
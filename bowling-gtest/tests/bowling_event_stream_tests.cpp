@@ -0,0 +1,124 @@
+#include "bowling_event_stream.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <string>
+
+using namespace ::testing;
+
+class MockGameScoreListener : public GameScoreListener
+{
+public:
+    MOCK_METHOD(void, game_completed, (const GameId&, unsigned int), (override));
+};
+
+namespace
+{
+    std::string perfect_game_events(std::uint32_t lane, std::uint64_t game)
+    {
+        std::string events;
+        for (int i = 0; i < 12; ++i)
+            events += std::to_string(lane) + " " + std::to_string(game) + " 10\n";
+
+        return events;
+    }
+} // namespace
+
+struct BowlingEventStreamTests : Test
+{
+    NiceMock<MockGameScoreListener> listener;
+    BowlingEventStream stream{listener};
+};
+
+TEST_F(BowlingEventStreamTests, CompletedGameIsReportedAndForgotten)
+{
+    EXPECT_CALL(listener, game_completed(GameId{3, 17}, 300));
+
+    stream.feed(perfect_game_events(3, 17));
+
+    ASSERT_EQ(stream.active_games(), 0);
+    ASSERT_EQ(stream.stats().events, 12);
+    ASSERT_EQ(stream.stats().completed_games, 1);
+}
+
+TEST_F(BowlingEventStreamTests, GamesInProgressHavePartialScores)
+{
+    stream.feed("1 1 10\n2 1 3\n1 1 4\n2 1 7\n");
+
+    ASSERT_EQ(stream.active_games(), 2);
+    ASSERT_EQ(stream.score(GameId{1, 1}), 18);
+    ASSERT_EQ(stream.score(GameId{2, 1}), 10);
+    ASSERT_EQ(stream.score(GameId{2, 2}), std::nullopt);
+}
+
+TEST_F(BowlingEventStreamTests, LinesCanBeSplitBetweenBuffers)
+{
+    EXPECT_CALL(listener, game_completed(GameId{3, 17}, 300));
+
+    for (char c : perfect_game_events(3, 17))
+        stream.feed(std::string_view{&c, 1});
+}
+
+TEST_F(BowlingEventStreamTests, LastLineWithoutNewLineIsParsedOnFinish)
+{
+    stream.feed("1 1 5");
+    ASSERT_EQ(stream.active_games(), 0);
+
+    stream.finish();
+
+    ASSERT_EQ(stream.score(GameId{1, 1}), 5);
+}
+
+TEST_F(BowlingEventStreamTests, MalformedLinesAreCountedAndSkipped)
+{
+    stream.feed("1 1 x\n1 1\n1 1 5 5\r\n\n1 1 4\r\n");
+
+    ASSERT_EQ(stream.stats().malformed_lines, 3);
+    ASSERT_EQ(stream.score(GameId{1, 1}), 4);
+}
+
+TEST_F(BowlingEventStreamTests, TooLongLineIsSkippedEvenWhenSplitBetweenBuffers)
+{
+    stream.feed(std::string(BowlingEventStream::max_line_length + 1, ' '));
+    stream.feed("1 1 9\n1 1 4\n");
+
+    ASSERT_EQ(stream.stats().malformed_lines, 1);
+    ASSERT_EQ(stream.score(GameId{1, 1}), 4);
+}
+
+TEST_F(BowlingEventStreamTests, InvalidRollsAreRejected)
+{
+    stream.feed("1 1 7\n1 1 4\n");
+
+    ASSERT_EQ(stream.stats().rejected_rolls, 1);
+    ASSERT_EQ(stream.score(GameId{1, 1}), 7);
+}
+
+TEST(BowlingEventStream_BoundedMemory, EventsOfNewGamesAreDroppedWhenTooManyGamesAreActive)
+{
+    NiceMock<MockGameScoreListener> listener;
+    BowlingEventStream stream{listener, 2};
+
+    stream.feed("1 1 1\n2 1 1\n3 1 1\n1 1 1\n");
+
+    ASSERT_EQ(stream.active_games(), 2);
+    ASSERT_EQ(stream.stats().dropped_events, 1);
+    ASSERT_EQ(stream.score(GameId{1, 1}), 2);
+}
+
+TEST(BowlingEventStream_ManyGames, InterleavedGamesAreScoredIndependently)
+{
+    NiceMock<MockGameScoreListener> listener;
+    BowlingEventStream stream{listener};
+
+    EXPECT_CALL(listener, game_completed(_, 300)).Times(100);
+
+    std::string events;
+    for (int roll = 0; roll < 12; ++roll)
+        for (std::uint32_t lane = 0; lane < 100; ++lane)
+            events += std::to_string(lane) + " 1 10\n";
+
+    stream.feed(events);
+
+    ASSERT_EQ(stream.active_games(), 0);
+}
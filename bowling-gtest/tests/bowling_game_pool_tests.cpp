@@ -0,0 +1,156 @@
+#include "bowling_game_pool.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <array>
+#include <memory_resource>
+
+using namespace ::testing;
+
+namespace
+{
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        size_t allocations = 0;
+        size_t deallocations = 0;
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override
+        {
+            ++deallocations;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+} // namespace
+
+TEST(GamePool, AcquiredGameIsNew)
+{
+    GamePool pool;
+
+    auto handle = pool.acquire();
+
+    ASSERT_TRUE(pool.contains(handle));
+    ASSERT_EQ(pool[handle].score(), 0);
+    ASSERT_EQ(pool.size(), 1);
+}
+
+TEST(GamePool, HandlesStayValidWhenPoolGrows)
+{
+    GamePool pool;
+
+    auto first = pool.acquire();
+    pool[first].roll(7);
+
+    for (int i = 0; i < 1'000; ++i)
+        pool.acquire();
+
+    ASSERT_EQ(pool[first].score(), 7);
+}
+
+TEST(GamePool, ReleasedSlotIsReusedWithNewGame)
+{
+    GamePool pool;
+
+    auto first = pool.acquire();
+    pool[first].roll(7);
+    pool.release(first);
+
+    auto second = pool.acquire();
+
+    ASSERT_EQ(second.index, first.index);
+    ASSERT_EQ(pool[second].score(), 0);
+    ASSERT_EQ(pool.size(), 1);
+}
+
+TEST(GamePool, HandleOfReleasedGameIsRejected)
+{
+    GamePool pool;
+
+    auto first = pool.acquire();
+    pool.release(first);
+    pool.acquire();
+
+    ASSERT_FALSE(pool.contains(first));
+    ASSERT_THROW(pool[first], std::invalid_argument);
+    ASSERT_THROW(pool.release(first), std::invalid_argument);
+}
+
+TEST(GamePool, ResetStartsGameFromScratch)
+{
+    GamePool pool;
+
+    auto handle = pool.acquire();
+    pool[handle].roll(10);
+    pool.reset(handle);
+
+    ASSERT_TRUE(pool.contains(handle));
+    ASSERT_EQ(pool[handle].score(), 0);
+}
+
+TEST(GamePool, ClearReleasesAllGames)
+{
+    GamePool pool;
+
+    auto first = pool.acquire();
+    auto second = pool.acquire();
+    pool.clear();
+
+    ASSERT_EQ(pool.size(), 0);
+    ASSERT_FALSE(pool.contains(first));
+    ASSERT_FALSE(pool.contains(second));
+}
+
+TEST(GamePool, WarmedUpPoolDoesNotAllocate)
+{
+    CountingResource resource;
+    GamePool pool{64, &resource};
+    const size_t allocations = resource.allocations;
+
+    for (int round = 0; round < 100; ++round)
+    {
+        std::array<GameHandle, 64> handles;
+        for (auto& handle : handles)
+            handle = pool.acquire();
+
+        for (auto handle : handles)
+            pool.release(handle);
+    }
+
+    ASSERT_EQ(resource.allocations, allocations);
+}
+
+TEST(GamePool, StateOfManyPoolsIsFreedWithTheirResource)
+{
+    CountingResource upstream;
+
+    {
+        std::pmr::monotonic_buffer_resource arena{&upstream};
+        std::pmr::vector<GamePool> lanes{&arena};
+
+        for (int lane = 0; lane < 10; ++lane)
+        {
+            auto& pool = lanes.emplace_back();
+            ASSERT_EQ(pool.get_allocator().resource(), &arena);
+
+            for (int player = 0; player < 6; ++player)
+                pool[pool.acquire()].roll(5);
+        }
+
+        ASSERT_GT(upstream.allocations, 0);
+        ASSERT_EQ(upstream.deallocations, 0);
+    }
+
+    ASSERT_EQ(upstream.deallocations, upstream.allocations);
+}
@@ -142,4 +142,85 @@ const BowlingTestParams bowling_test_input[] = {
     {{1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 10}, 119},
     {{10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10}, 300}};
 
-INSTANTIATE_TEST_SUITE_P(PackOfBowlingTests, BowlingBulkTests, ::testing::ValuesIn(bowling_test_input));
\ No newline at end of file
+INSTANTIATE_TEST_SUITE_P(PackOfBowlingTests, BowlingBulkTests, ::testing::ValuesIn(bowling_test_input));
+
+///////////////////////////////////////////////
+// Scoresheet
+
+struct BowlingScoresheetTests : BowlingGameTests
+{
+    void roll_all(std::initializer_list<unsigned int> pins)
+    {
+        for (auto p : pins)
+            game.roll(p);
+    }
+};
+
+TEST_F(BowlingScoresheetTests, CumulativeScoresOfCompleteGame)
+{
+    using namespace ::testing;
+
+    roll_all({10, 7, 3, 9, 0, 10, 0, 8, 8, 2, 0, 6, 10, 10, 10, 8, 1});
+
+    std::vector<unsigned int> cumulative_scores;
+    for (size_t frame = 0; frame < 10; ++frame)
+        cumulative_scores.push_back(game.cumulative_score(frame));
+
+    ASSERT_THAT(cumulative_scores, ElementsAre(20, 39, 48, 66, 74, 84, 90, 120, 148, 167));
+    ASSERT_EQ(game.score(), 167);
+    ASSERT_EQ(game.scored_frames(), 10);
+}
+
+TEST_F(BowlingScoresheetTests, FramesOutOfTheGameScoreZero)
+{
+    roll_all({10, 7, 3, 9, 0, 10, 0, 8, 8, 2, 0, 6, 10, 10, 10, 8, 1});
+
+    ASSERT_TRUE(game.is_over());
+    ASSERT_EQ(game.frame_score(10), 0);
+    ASSERT_EQ(game.cumulative_score(10), 0);
+    ASSERT_EQ(game.frame_score(9), 19);
+}
+
+TEST_F(BowlingScoresheetTests, StrikeIsNotScoredUntilTwoBonusRollsAreKnown)
+{
+    roll_strike();
+    game.roll(3);
+
+    ASSERT_EQ(game.scored_frames(), 0);
+    ASSERT_EQ(game.frame_score(0), 13);
+
+    game.roll(4);
+
+    ASSERT_EQ(game.scored_frames(), 2);
+    ASSERT_EQ(game.frame_score(0), 17);
+    ASSERT_EQ(game.frame_score(1), 7);
+    ASSERT_EQ(game.cumulative_score(1), 24);
+}
+
+TEST_F(BowlingScoresheetTests, SpareIsScoredAfterNextRoll)
+{
+    roll_spare();
+
+    ASSERT_EQ(game.scored_frames(), 0);
+
+    game.roll(5);
+
+    ASSERT_EQ(game.scored_frames(), 1);
+    ASSERT_EQ(game.frame_score(0), 15);
+    ASSERT_EQ(game.cumulative_score(1), 20);
+}
+
+TEST_F(BowlingScoresheetTests, FramesNotRolledYetHaveNoScore)
+{
+    roll_all({3, 4});
+
+    ASSERT_EQ(game.frame_score(5), 0);
+    ASSERT_EQ(game.cumulative_score(5), 0);
+}
+
+TEST_F(BowlingScoresheetTests, RollsAfterEndOfGameAreIgnored)
+{
+    roll_many(25, 10);
+
+    ASSERT_EQ(game.score(), 300);
+}
@@ -0,0 +1,113 @@
+#include "bowling_batch.hpp"
+#include "bowling_event_stream.hpp"
+#include "bowling_game.hpp"
+#include "packed_bowling_game.hpp"
+#include "random_games.hpp"
+#include "reference_bowling_game.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+using namespace TestHelpers;
+
+// Differential tests - every scorer must agree with ReferenceBowlingGame
+// on random legal games and on every game in progress
+struct BowlingScorers_Fuzz : TestWithParam<std::uint64_t>
+{
+    constexpr static size_t games_count = 2'000;
+
+    std::vector<std::vector<unsigned int>> random_games()
+    {
+        BowlingGameGenerator generator{GetParam()};
+
+        std::vector<std::vector<unsigned int>> games(games_count);
+        for (auto& game : games)
+            game = generator.next_game();
+
+        return games;
+    }
+};
+
+TEST_P(BowlingScorers_Fuzz, SingleGameScorersAgreeAfterEveryRoll)
+{
+    for (const auto& rolls : random_games())
+    {
+        ReferenceBowlingGame reference;
+        BowlingGame game;
+        CheckedBowlingGame checked_game;
+        PackedBowlingGame packed_game;
+
+        for (auto pins : rolls)
+        {
+            ASSERT_FALSE(checked_game.is_over()) << testing::PrintToString(rolls);
+
+            reference.roll(pins);
+            game.roll(pins);
+            ASSERT_EQ(checked_game.roll(pins), BowlingErrc::ok);
+            ASSERT_EQ(packed_game.roll(pins), BowlingErrc::ok);
+
+            ASSERT_EQ(game.score(), reference.score()) << testing::PrintToString(rolls);
+            ASSERT_EQ(checked_game.score(), reference.score()) << testing::PrintToString(rolls);
+            ASSERT_EQ(packed_game.score(), reference.score()) << testing::PrintToString(rolls);
+        }
+
+        ASSERT_TRUE(checked_game.is_over()) << testing::PrintToString(rolls);
+        ASSERT_EQ(checked_game.roll(0), BowlingErrc::game_over) << testing::PrintToString(rolls);
+    }
+}
+
+TEST_P(BowlingScorers_Fuzz, BatchScorerAgreesWithReference)
+{
+    const auto games = random_games();
+
+    BowlingGameBatch batch(games.size());
+    std::vector<unsigned int> expected_scores;
+
+    for (size_t i = 0; i < games.size(); ++i)
+    {
+        auto rolls = games[i];
+        rolls.resize(rolls.size() - i % 5); // some games in progress
+
+        batch.set_rolls(i, rolls);
+        expected_scores.push_back(score_of<ReferenceBowlingGame>(rolls));
+    }
+
+    ASSERT_EQ(batch.score(2), expected_scores);
+}
+
+TEST_P(BowlingScorers_Fuzz, EventStreamAgreesWithReference)
+{
+    struct ScoresListener : GameScoreListener
+    {
+        std::vector<unsigned int> scores = std::vector<unsigned int>(games_count);
+
+        void game_completed(const GameId& id, unsigned int score) override
+        {
+            scores[id.game] = score;
+        }
+    } listener;
+
+    const auto games = random_games();
+
+    std::string events;
+    std::vector<unsigned int> expected_scores;
+
+    for (size_t i = 0; i < games.size(); ++i)
+    {
+        for (auto pins : games[i])
+            events += std::to_string(i % 16) + " " + std::to_string(i) + " " + std::to_string(pins) + "\n";
+
+        expected_scores.push_back(score_of<ReferenceBowlingGame>(games[i]));
+    }
+
+    BowlingEventStream stream{listener};
+    stream.feed(events);
+
+    ASSERT_EQ(stream.stats().completed_games, games.size());
+    ASSERT_EQ(listener.scores, expected_scores);
+}
+
+INSTANTIATE_TEST_SUITE_P(Seeds, BowlingScorers_Fuzz, Values(1u, 42u, 2024u));
@@ -0,0 +1,107 @@
+#include "bowling_tournament.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+
+struct BowlingTournamentTests : Test
+{
+    BowlingTournament tournament{3, 2};
+
+    void roll_many(size_t lane, size_t player, unsigned int count, unsigned int pins)
+    {
+        for (auto i = 0u; i < count; ++i)
+            ASSERT_EQ(tournament.roll(lane, player, pins), BowlingErrc::ok);
+    }
+};
+
+TEST_F(BowlingTournamentTests, NewTournamentHasZeroScores)
+{
+    ASSERT_EQ(tournament.score(2, 1), 0);
+    ASSERT_THAT(tournament.top(2), ElementsAre(LeaderboardEntry{0, 0, 0}, LeaderboardEntry{0, 1, 0}));
+}
+
+TEST_F(BowlingTournamentTests, RollsAreScoredPerPlayer)
+{
+    roll_many(1, 0, 2, 5);
+    roll_many(1, 1, 1, 3);
+    roll_many(1, 0, 1, 4);
+
+    ASSERT_EQ(tournament.score(1, 0), 18);
+    ASSERT_EQ(tournament.score(1, 1), 3);
+}
+
+TEST_F(BowlingTournamentTests, InvalidRollIsRejected)
+{
+    roll_many(0, 0, 1, 7);
+
+    ASSERT_EQ(tournament.roll(0, 0, 4), BowlingErrc::too_many_pins);
+    ASSERT_EQ(tournament.score(0, 0), 7);
+}
+
+TEST_F(BowlingTournamentTests, UnknownPlayerThrows)
+{
+    ASSERT_THROW(tournament.roll(3, 0, 1), std::out_of_range);
+    ASSERT_THROW(tournament.score(0, 2), std::out_of_range);
+}
+
+TEST_F(BowlingTournamentTests, LeaderboardListsBestPlayersFirst)
+{
+    roll_many(0, 1, 3, 3);
+    roll_many(2, 0, 1, 10);
+    roll_many(1, 1, 1, 9);
+
+    ASSERT_THAT(tournament.top(3), ElementsAre(LeaderboardEntry{2, 0, 10}, LeaderboardEntry{0, 1, 9}, LeaderboardEntry{1, 1, 9}));
+    ASSERT_EQ(tournament.top(100).size(), 6);
+}
+
+TEST_F(BowlingTournamentTests, NewGameResetsScore)
+{
+    roll_many(0, 0, 12, 10);
+    ASSERT_TRUE(tournament.is_over(0, 0));
+
+    tournament.start_new_game(0, 0);
+
+    ASSERT_FALSE(tournament.is_over(0, 0));
+    ASSERT_EQ(tournament.score(0, 0), 0);
+}
+
+TEST(BowlingTournament_Concurrency, LanesRollConcurrentlyWhileLeaderboardIsRead)
+{
+    constexpr size_t lanes_count = 8;
+    constexpr size_t players_per_lane = 4;
+
+    BowlingTournament tournament{lanes_count, players_per_lane};
+    std::atomic<bool> rolling{true};
+
+    std::jthread reader{[&] {
+        while (rolling)
+        {
+            auto leaderboard = tournament.top(5);
+
+            for (size_t i = 1; i < leaderboard.size(); ++i)
+                ASSERT_GE(leaderboard[i - 1].score, leaderboard[i].score);
+        }
+    }};
+
+    {
+        std::vector<std::jthread> lanes;
+        for (size_t lane = 0; lane < lanes_count; ++lane)
+            lanes.emplace_back([&tournament, lane] {
+                for (size_t frame = 0; frame < 12; ++frame)
+                    for (size_t player = 0; player < players_per_lane; ++player)
+                        tournament.roll(lane, player, player == 0 ? 10 : 4);
+            });
+    }
+
+    rolling = false;
+
+    auto leaderboard = tournament.top(lanes_count);
+
+    ASSERT_THAT(leaderboard, Each(Field(&LeaderboardEntry::player, 0)));
+    ASSERT_THAT(leaderboard, Each(Field(&LeaderboardEntry::score, 300)));
+    ASSERT_EQ(tournament.score(7, 3), 48);
+}
@@ -0,0 +1,99 @@
+#include "bowling_game.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+class CheckedBowlingGameTests : public ::testing::Test
+{
+protected:
+    CheckedBowlingGame game;
+
+    void roll_many(unsigned int count, unsigned int pins)
+    {
+        for (auto i = 0u; i < count; ++i)
+            ASSERT_EQ(game.roll(pins), BowlingErrc::ok);
+    }
+};
+
+TEST_F(CheckedBowlingGameTests, ValidRollIsAccepted)
+{
+    ASSERT_EQ(game.roll(7), BowlingErrc::ok);
+    ASSERT_EQ(game.score(), 7);
+}
+
+TEST_F(CheckedBowlingGameTests, RollOfMoreThanTenPinsIsRejected)
+{
+    ASSERT_EQ(game.roll(11), BowlingErrc::too_many_pins);
+}
+
+TEST_F(CheckedBowlingGameTests, FrameWithMoreThanTenPinsIsRejected)
+{
+    game.roll(7);
+
+    ASSERT_EQ(game.roll(4), BowlingErrc::too_many_pins);
+}
+
+TEST_F(CheckedBowlingGameTests, RejectedRollDoesNotChangeTheGame)
+{
+    game.roll(7);
+    game.roll(4);
+
+    ASSERT_EQ(game.score(), 7);
+    ASSERT_EQ(game.pins_standing(), 3);
+    ASSERT_EQ(game.roll(3), BowlingErrc::ok);
+}
+
+TEST_F(CheckedBowlingGameTests, RollAfterOpenTenthFrameIsRejected)
+{
+    roll_many(20, 1);
+
+    ASSERT_TRUE(game.is_over());
+    ASSERT_EQ(game.roll(1), BowlingErrc::game_over);
+    ASSERT_EQ(game.score(), 20);
+}
+
+TEST_F(CheckedBowlingGameTests, SpareInTenthFrameGivesOneFillBall)
+{
+    roll_many(18, 1);
+    roll_many(2, 5);
+
+    ASSERT_FALSE(game.is_over());
+    ASSERT_EQ(game.roll(10), BowlingErrc::ok);
+    ASSERT_TRUE(game.is_over());
+    ASSERT_EQ(game.roll(1), BowlingErrc::game_over);
+}
+
+TEST_F(CheckedBowlingGameTests, StrikeInTenthFrameGivesTwoFillBalls)
+{
+    roll_many(18, 1);
+    roll_many(1, 10);
+
+    ASSERT_EQ(game.roll(5), BowlingErrc::ok);
+    ASSERT_EQ(game.roll(6), BowlingErrc::too_many_pins);
+    ASSERT_EQ(game.roll(5), BowlingErrc::ok);
+    ASSERT_TRUE(game.is_over());
+}
+
+TEST_F(CheckedBowlingGameTests, PerfectGameHasTwelveRolls)
+{
+    roll_many(12, 10);
+
+    ASSERT_EQ(game.roll(10), BowlingErrc::game_over);
+    ASSERT_EQ(game.score(), 300);
+}
+
+TEST(BowlingErrc, ConvertsToErrorCode)
+{
+    std::error_code error = BowlingErrc::too_many_pins;
+
+    ASSERT_EQ(error.category().name(), std::string{"bowling"});
+    ASSERT_EQ(error.message(), "more pins than are standing");
+    ASSERT_FALSE(std::error_code{BowlingErrc::ok});
+}
+
+TEST(TrustedBowlingGame, DoesNotValidateRolls)
+{
+    BowlingGame game;
+
+    ASSERT_EQ(game.roll(11), BowlingErrc::ok);
+    ASSERT_EQ(game.score(), 11);
+}
@@ -0,0 +1,57 @@
+#include "bowling_frame_table.hpp"
+#include "bowling_game.hpp"
+#include "packed_bowling_game.hpp"
+#include "gtest/gtest.h"
+
+#include <initializer_list>
+
+namespace
+{
+    template <typename TGame>
+    constexpr unsigned int score_of(std::initializer_list<unsigned int> rolls)
+    {
+        TGame game;
+        for (auto pins : rolls)
+            game.roll(pins);
+
+        return game.score();
+    }
+
+    constexpr unsigned int cumulative_score_of(std::initializer_list<unsigned int> rolls, size_t frame)
+    {
+        BowlingGame game;
+        for (auto pins : rolls)
+            game.roll(pins);
+
+        return game.cumulative_score(frame);
+    }
+} // namespace
+
+static_assert(score_of<BowlingGame>({}) == 0);
+static_assert(score_of<BowlingGame>({10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10}) == 300);
+static_assert(score_of<BowlingGame>({1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 1, 9, 10}) == 119);
+static_assert(score_of<CheckedBowlingGame>({10, 3, 6, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}) == 44);
+static_assert(score_of<PackedBowlingGame>({1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 5, 5}) == 38);
+static_assert(cumulative_score_of({10, 7, 3, 9, 0, 10, 0, 8, 8, 2, 0, 6, 10, 10, 10, 8, 1}, 4) == 74);
+
+static_assert(lookup_frame_score(10, 3, 4).points == 17 && lookup_frame_score(10, 3, 4).rolls == 1);
+static_assert(lookup_frame_score(6, 4, 8).points == 18 && lookup_frame_score(6, 4, 8).rolls == 2);
+static_assert(lookup_frame_score(6, 3, 8).points == 9 && lookup_frame_score(6, 3, 8).rolls == 2);
+
+TEST(BowlingFrameTable, MatchesFrameRules)
+{
+    for (unsigned int first = 0; first <= 10; ++first)
+        for (unsigned int second = 0; second <= 10; ++second)
+            for (unsigned int third = 0; third <= 10; ++third)
+            {
+                auto [points, rolls] = lookup_frame_score(first, second, third);
+
+                if (first == 10)
+                    ASSERT_EQ(rolls, 1);
+                else
+                    ASSERT_EQ(rolls, 2);
+
+                unsigned int expected_points = (first == 10 || first + second == 10) ? first + second + third : first + second;
+                ASSERT_EQ(points, expected_points);
+            }
+}
@@ -0,0 +1,70 @@
+#include "packed_bowling_game.hpp"
+#include "random_games.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+
+TEST(PackedBowlingGame, TakesTwelveBytes)
+{
+    ASSERT_EQ(sizeof(PackedBowlingGame), 12u);
+}
+
+TEST(PackedBowlingGame, NewGameScoreIsZero)
+{
+    PackedBowlingGame game;
+
+    ASSERT_EQ(game.score(), 0);
+    ASSERT_EQ(game.rolls_count(), 0);
+}
+
+TEST(PackedBowlingGame, StoresRollsInOrder)
+{
+    PackedBowlingGame game;
+
+    game.roll(3);
+    game.roll(10);
+    game.roll(0);
+
+    ASSERT_EQ(game.rolls_count(), 3);
+    ASSERT_THAT((std::vector{game.pins(0), game.pins(1), game.pins(2)}), ElementsAre(3, 10, 0));
+}
+
+TEST(PackedBowlingGame, RejectsRollsThatDoNotFit)
+{
+    PackedBowlingGame game;
+
+    ASSERT_EQ(game.roll(11), BowlingErrc::too_many_pins);
+
+    for (int i = 0; i < 21; ++i)
+        game.roll(1);
+
+    ASSERT_EQ(game.roll(1), BowlingErrc::game_over);
+}
+
+TEST(PackedBowlingGame, PerfectGame)
+{
+    PackedBowlingGame game;
+
+    for (int i = 0; i < 12; ++i)
+        game.roll(10);
+
+    ASSERT_EQ(game.score(), 300);
+}
+
+TEST(PackedBowlingGame, ScoreMatchesBowlingGame)
+{
+    BowlingGameGenerator games{34};
+
+    for (int i = 0; i < 2'000; ++i)
+    {
+        auto rolls = games.next_game();
+        rolls.resize(rolls.size() - i % 3);
+
+        PackedBowlingGame game;
+        for (auto pins : rolls)
+            game.roll(pins);
+
+        ASSERT_EQ(game.score(), TestHelpers::score_of(rolls));
+    }
+}
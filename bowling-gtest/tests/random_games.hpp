@@ -0,0 +1,22 @@
+#ifndef RANDOM_GAMES_HPP
+#define RANDOM_GAMES_HPP
+
+#include "bowling_game.hpp"
+#include "bowling_game_generator.hpp"
+
+#include <vector>
+
+namespace TestHelpers
+{
+    template <typename TGame = BowlingGame>
+    auto score_of(const std::vector<unsigned int>& rolls)
+    {
+        TGame game;
+        for (auto pins : rolls)
+            game.roll(pins);
+
+        return game.score();
+    }
+} // namespace TestHelpers
+
+#endif // RANDOM_GAMES_HPP
@@ -0,0 +1,110 @@
+#include "bowling_batch.hpp"
+#include "bowling_game.hpp"
+#include "bowling_game_generator.hpp"
+#include "packed_bowling_game.hpp"
+#include "reference_bowling_game.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    size_t sink = 0;
+
+    template <typename Operation>
+    double games_per_second(size_t games_count, Operation operation)
+    {
+        auto start = chrono::steady_clock::now();
+
+        operation();
+
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+        return games_count / elapsed.count();
+    }
+
+    void report(const char* scenario, const char* scorer, double games_per_second)
+    {
+        printf("%-16s %-32s %16.0f\n", scenario, scorer, games_per_second);
+    }
+
+    // all rolls first, then a single score
+    template <typename Game>
+    void run_single_game(const char* name, const vector<vector<unsigned int>>& games)
+    {
+        report("single-game", name, games_per_second(games.size(), [&] {
+            for (const auto& rolls : games)
+            {
+                Game game;
+                for (auto pins : rolls)
+                    game.roll(pins);
+
+                sink += game.score();
+            }
+        }));
+    }
+
+    // score read after every roll - as on a live scoreboard
+    template <typename Game>
+    void run_incremental(const char* name, const vector<vector<unsigned int>>& games)
+    {
+        report("incremental", name, games_per_second(games.size(), [&] {
+            for (const auto& rolls : games)
+            {
+                Game game;
+                for (auto pins : rolls)
+                {
+                    game.roll(pins);
+                    sink += game.score();
+                }
+            }
+        }));
+    }
+
+    void run_batch(const vector<vector<unsigned int>>& games, size_t thread_count)
+    {
+        BowlingGameBatch batch(games.size());
+        for (size_t i = 0; i < games.size(); ++i)
+            batch.set_rolls(i, games[i]);
+
+        vector<unsigned int> scores(games.size());
+
+        char name[64];
+        snprintf(name, sizeof(name), "BowlingGameBatch (%zu threads)", thread_count);
+
+        report("batch", name, games_per_second(games.size(), [&] { batch.score(scores, thread_count); }));
+
+        sink += scores.back();
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const size_t games_count = (argc > 1) ? strtoull(argv[1], nullptr, 10) : 1'000'000;
+
+    BowlingGameGenerator generator{2024};
+
+    vector<vector<unsigned int>> games(games_count);
+    for (auto& game : games)
+        game = generator.next_game();
+
+    printf("%-16s %-32s %16s\n", "scenario", "scorer", "games/s");
+
+    run_single_game<ReferenceBowlingGame>("ReferenceBowlingGame", games);
+    run_single_game<BowlingGame>("BowlingGame", games);
+    run_single_game<CheckedBowlingGame>("CheckedBowlingGame", games);
+    run_single_game<PackedBowlingGame>("PackedBowlingGame", games);
+
+    run_incremental<ReferenceBowlingGame>("ReferenceBowlingGame", games);
+    run_incremental<BowlingGame>("BowlingGame", games);
+    run_incremental<CheckedBowlingGame>("CheckedBowlingGame", games);
+
+    run_batch(games, 1);
+    run_batch(games, max(1u, thread::hardware_concurrency()));
+
+    return sink == 0 ? 1 : 0;
+}
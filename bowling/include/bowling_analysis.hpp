@@ -0,0 +1,244 @@
+#ifndef BOWLING_ANALYSIS_HPP
+#define BOWLING_ANALYSIS_HPP
+
+#include "bowling_game.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+// Probability of knocking down k pins when n pins are standing - P(k | n)
+class PinfallModel
+{
+public:
+    constexpr static unsigned int max_pins = 10;
+
+    using Probabilities = std::array<std::array<double, max_pins + 1>, max_pins + 1>;
+
+    // probabilities[standing][pins] - every row for 1..10 standing pins must sum to 1
+    explicit PinfallModel(const Probabilities& probabilities)
+        : probabilities_{probabilities}
+    {
+        for (unsigned int standing = 1; standing <= max_pins; ++standing)
+        {
+            double total = 0.0;
+
+            for (unsigned int pins = 0; pins <= max_pins; ++pins)
+            {
+                const double p = probabilities_[standing][pins];
+
+                if (p < 0.0 || (pins > standing && p != 0.0))
+                    throw std::invalid_argument("invalid pinfall probability");
+
+                total += p;
+            }
+
+            if (std::abs(total - 1.0) > 1e-9)
+                throw std::invalid_argument("pinfall probabilities do not sum to 1");
+        }
+    }
+
+    // every legal number of pins is equally likely
+    static PinfallModel uniform()
+    {
+        Probabilities probabilities{};
+
+        for (unsigned int standing = 1; standing <= max_pins; ++standing)
+            for (unsigned int pins = 0; pins <= standing; ++pins)
+                probabilities[standing][pins] = 1.0 / (standing + 1);
+
+        return PinfallModel{probabilities};
+    }
+
+    // counts[standing][pins] - how many times a player knocked down pins when standing pins were left;
+    // rows without any observation are uniform
+    static PinfallModel from_history(const std::array<std::array<unsigned int, max_pins + 1>, max_pins + 1>& counts)
+    {
+        Probabilities probabilities{};
+
+        for (unsigned int standing = 1; standing <= max_pins; ++standing)
+        {
+            unsigned int total = 0;
+            for (unsigned int pins = 0; pins <= standing; ++pins)
+                total += counts[standing][pins];
+
+            for (unsigned int pins = 0; pins <= standing; ++pins)
+                probabilities[standing][pins] = total == 0 ? 1.0 / (standing + 1) : static_cast<double>(counts[standing][pins]) / total;
+        }
+
+        return PinfallModel{probabilities};
+    }
+
+    double probability(unsigned int standing, unsigned int pins) const
+    {
+        return probabilities_[standing][pins];
+    }
+
+private:
+    Probabilities probabilities_;
+};
+
+struct ScoreOutlook
+{
+    unsigned int min_score;
+    unsigned int max_score;
+    std::vector<double> distribution; // distribution[score] - probability of the final score
+
+    double expected_score() const
+    {
+        double result = 0.0;
+
+        for (size_t score = 0; score < distribution.size(); ++score)
+            result += score * distribution[score];
+
+        return result;
+    }
+
+    double probability(unsigned int score) const
+    {
+        return score < distribution.size() ? distribution[score] : 0.0;
+    }
+};
+
+namespace BowlingAnalysis
+{
+    // The points a game can still get depend only on the current frame, the position in it,
+    // the standing pins and the bonus rolls still owed to the last two frames - 2178 states.
+    // Every state is solved once, by rolling each possible number of pins on a copy of the game,
+    // so the whole game tree is covered exactly without enumerating it.
+    template <typename TRollPolicy>
+    class OutlookSolver
+    {
+        using Game = BasicBowlingGame<TRollPolicy>;
+
+        constexpr static size_t frames_count = 10;
+        constexpr static size_t states_count = (frames_count + 1) * 2 * (PinfallModel::max_pins + 1) * 3 * 3;
+
+        struct Bounds
+        {
+            unsigned int min_points;
+            unsigned int max_points;
+        };
+
+    public:
+        explicit OutlookSolver(const PinfallModel& model)
+            : model_{model}
+            , distributions_(states_count)
+            , bounds_(states_count)
+        {
+        }
+
+        ScoreOutlook solve(const Game& game)
+        {
+            if (game.pins_standing() > PinfallModel::max_pins)
+                throw std::invalid_argument("game is not in a legal state");
+
+            const auto [min_points, max_points] = bounds(game);
+            const auto& points = distribution(game);
+
+            ScoreOutlook outlook{game.score() + min_points, game.score() + max_points, std::vector<double>(game.score() + points.size())};
+            std::copy(points.begin(), points.end(), outlook.distribution.begin() + game.score());
+
+            return outlook;
+        }
+
+    private:
+        const PinfallModel& model_;
+        std::vector<std::vector<double>> distributions_; // points still to be scored - computed when empty
+        std::vector<std::optional<Bounds>> bounds_;
+
+        static size_t state(const Game& game)
+        {
+            const size_t frame = game.frame();
+            const unsigned int owed_two_frames_back = frame >= 2 ? game.bonus_rolls(frame - 2) : 0;
+            const unsigned int owed_one_frame_back = frame >= 1 ? game.bonus_rolls(frame - 1) : 0;
+
+            return (((frame * 2 + game.is_first_roll_in_frame()) * (PinfallModel::max_pins + 1) + game.pins_standing()) * 3 + owed_two_frames_back) * 3
+                + owed_one_frame_back;
+        }
+
+        static Game after_roll(const Game& game, unsigned int pins)
+        {
+            Game next = game;
+            next.roll(pins);
+
+            return next;
+        }
+
+        Bounds bounds(const Game& game)
+        {
+            if (game.is_over())
+                return {0, 0};
+
+            auto& memo = bounds_[state(game)];
+
+            if (!memo)
+            {
+                Bounds result{~0u, 0};
+
+                for (unsigned int pins = 0; pins <= game.pins_standing(); ++pins)
+                {
+                    const Game next = after_roll(game, pins);
+                    const unsigned int points = next.score() - game.score();
+                    const auto [min_points, max_points] = bounds(next);
+
+                    result.min_points = std::min(result.min_points, points + min_points);
+                    result.max_points = std::max(result.max_points, points + max_points);
+                }
+
+                memo = result;
+            }
+
+            return *memo;
+        }
+
+        const std::vector<double>& distribution(const Game& game)
+        {
+            static const std::vector<double> no_more_points{1.0};
+
+            if (game.is_over())
+                return no_more_points;
+
+            auto& memo = distributions_[state(game)];
+
+            if (memo.empty())
+            {
+                std::vector<double> result;
+
+                for (unsigned int pins = 0; pins <= game.pins_standing(); ++pins)
+                {
+                    const double p = model_.probability(game.pins_standing(), pins);
+
+                    if (p == 0.0)
+                        continue;
+
+                    const Game next = after_roll(game, pins);
+                    const unsigned int points = next.score() - game.score();
+                    const auto& rest = distribution(next);
+
+                    result.resize(std::max(result.size(), points + rest.size()));
+
+                    for (size_t i = 0; i < rest.size(); ++i)
+                        result[points + i] += p * rest[i];
+                }
+
+                memo = std::move(result);
+            }
+
+            return memo;
+        }
+    };
+} // namespace BowlingAnalysis
+
+// Exact range and distribution of the final score of a game in progress
+template <typename TRollPolicy>
+ScoreOutlook analyze_game(const BasicBowlingGame<TRollPolicy>& game, const PinfallModel& model = PinfallModel::uniform())
+{
+    return BowlingAnalysis::OutlookSolver<TRollPolicy>{model}.solve(game);
+}
+
+#endif // BOWLING_ANALYSIS_HPP
@@ -0,0 +1,150 @@
+#ifndef BOWLING_BATCH_HPP
+#define BOWLING_BATCH_HPP
+
+#include "packed_bowling_game.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// Rolls of many games stored as structure of arrays:
+// roll r of game g is at rolls_[r * size() + g], rolls after the end of a game are zero.
+//
+// Scoring walks the rolls in order and keeps the frame state of every game in
+// separate arrays, so each step is the same branch-free arithmetic for all games
+// of a block and the inner loop is vectorised by the compiler.
+class BowlingGameBatch
+{
+public:
+    constexpr static size_t max_rolls = 21;
+
+    explicit BowlingGameBatch(size_t game_count)
+        : game_count_{game_count}
+        , rolls_(max_rolls * game_count)
+    {
+    }
+
+    size_t size() const
+    {
+        return game_count_;
+    }
+
+    void set_rolls(size_t game, std::span<const unsigned int> rolls)
+    {
+        if (rolls.size() > max_rolls)
+            throw std::length_error("bowling game has more than 21 rolls");
+
+        for (size_t roll_no = 0; roll_no < max_rolls; ++roll_no)
+            rolls_[roll_no * game_count_ + game] = roll_no < rolls.size() ? static_cast<std::uint8_t>(rolls[roll_no]) : 0;
+    }
+
+    void set_rolls(size_t game, std::initializer_list<unsigned int> rolls)
+    {
+        set_rolls(game, std::span{rolls.begin(), rolls.size()});
+    }
+
+    void set_rolls(size_t game, const PackedBowlingGame& packed_game)
+    {
+        for (size_t roll_no = 0; roll_no < max_rolls; ++roll_no)
+            rolls_[roll_no * game_count_ + game] = static_cast<std::uint8_t>(packed_game.pins(roll_no));
+    }
+
+    unsigned int roll(size_t game, size_t roll_no) const
+    {
+        return rolls_[roll_no * game_count_ + game];
+    }
+
+    std::vector<unsigned int> score(size_t thread_count = std::thread::hardware_concurrency()) const
+    {
+        std::vector<unsigned int> scores(game_count_);
+        score(scores, thread_count);
+
+        return scores;
+    }
+
+    void score(std::span<unsigned int> scores, size_t thread_count = std::thread::hardware_concurrency()) const
+    {
+        const size_t blocks_count = (game_count_ + block_size - 1) / block_size;
+        thread_count = std::clamp<size_t>(thread_count, 1, std::max<size_t>(blocks_count, 1));
+
+        if (thread_count == 1)
+        {
+            score_range(0, game_count_, scores);
+            return;
+        }
+
+        const size_t blocks_per_thread = (blocks_count + thread_count - 1) / thread_count;
+
+        std::vector<std::jthread> threads;
+        threads.reserve(thread_count);
+
+        for (size_t first_block = 0; first_block < blocks_count; first_block += blocks_per_thread)
+        {
+            size_t first = first_block * block_size;
+            size_t last = std::min(game_count_, (first_block + blocks_per_thread) * block_size);
+
+            threads.emplace_back([this, first, last, scores] { score_range(first, last, scores); });
+        }
+    }
+
+private:
+    constexpr static size_t block_size = 256;
+    constexpr static std::uint16_t frames_count = 10;
+    constexpr static std::uint16_t all_pins_in_frame = 10;
+
+    size_t game_count_;
+    std::vector<std::uint8_t> rolls_;
+
+    void score_range(size_t first, size_t last, std::span<unsigned int> scores) const
+    {
+        for (size_t block = first; block < last; block += block_size)
+            score_block(block, std::min(block_size, last - block), scores);
+    }
+
+    void score_block(size_t first, size_t count, std::span<unsigned int> scores) const
+    {
+        std::array<std::uint16_t, block_size> score{};
+        std::array<std::uint16_t, block_size> frame{};
+        std::array<std::uint16_t, block_size> is_first_roll{};
+        std::array<std::uint16_t, block_size> pins_standing{};
+        std::array<std::uint16_t, block_size> next_roll_bonus{};
+        std::array<std::uint16_t, block_size> second_next_roll_bonus{};
+
+        is_first_roll.fill(1);
+        pins_standing.fill(all_pins_in_frame);
+
+        for (size_t roll_no = 0; roll_no < max_rolls; ++roll_no)
+        {
+            const std::uint8_t* pins = rolls_.data() + roll_no * game_count_ + first;
+
+            for (size_t g = 0; g < count; ++g)
+            {
+                const std::uint16_t p = pins[g];
+                const std::uint16_t in_frame = frame[g] < frames_count;
+
+                score[g] += p * (in_frame + next_roll_bonus[g]);
+
+                const std::uint16_t standing = pins_standing[g] - p;
+                const std::uint16_t all_down = in_frame & (standing == 0);
+                const std::uint16_t strike = all_down & is_first_roll[g];
+                const std::uint16_t frame_done = in_frame & (strike | (is_first_roll[g] ^ 1));
+
+                next_roll_bonus[g] = second_next_roll_bonus[g] + all_down;
+                second_next_roll_bonus[g] = strike;
+                frame[g] += frame_done;
+                is_first_roll[g] = frame_done | (in_frame ^ 1);
+                pins_standing[g] = frame_done ? all_pins_in_frame : standing;
+            }
+        }
+
+        std::copy_n(score.begin(), count, scores.begin() + first);
+    }
+};
+
+#endif // BOWLING_BATCH_HPP
@@ -0,0 +1,59 @@
+#ifndef BOWLING_ERROR_HPP
+#define BOWLING_ERROR_HPP
+
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+enum class BowlingErrc
+{
+    ok = 0,
+    too_many_pins,
+    game_over
+};
+
+class BowlingErrorCategory : public std::error_category
+{
+public:
+    const char* name() const noexcept override
+    {
+        return "bowling";
+    }
+
+    std::string message(int condition) const override
+    {
+        switch (static_cast<BowlingErrc>(condition))
+        {
+        case BowlingErrc::ok:
+            return "ok";
+        case BowlingErrc::too_many_pins:
+            return "more pins than are standing";
+        case BowlingErrc::game_over:
+            return "game is over";
+        }
+
+        return "unknown bowling error";
+    }
+};
+
+inline const std::error_category& bowling_category()
+{
+    static BowlingErrorCategory category;
+
+    return category;
+}
+
+inline std::error_code make_error_code(BowlingErrc errc)
+{
+    return {static_cast<int>(errc), bowling_category()};
+}
+
+namespace std
+{
+    template <>
+    struct is_error_code_enum<BowlingErrc> : true_type
+    {
+    };
+} // namespace std
+
+#endif // BOWLING_ERROR_HPP
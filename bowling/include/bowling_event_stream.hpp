@@ -0,0 +1,219 @@
+#ifndef BOWLING_EVENT_STREAM_HPP
+#define BOWLING_EVENT_STREAM_HPP
+
+#include "bowling_game.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+struct GameId
+{
+    std::uint32_t lane;
+    std::uint64_t game;
+
+    bool operator==(const GameId& other) const = default;
+};
+
+struct GameIdHash
+{
+    size_t operator()(const GameId& id) const noexcept
+    {
+        return std::hash<std::uint64_t>{}(id.game * 0x9E3779B97F4A7C15ull ^ id.lane);
+    }
+};
+
+class GameScoreListener
+{
+public:
+    virtual void game_completed(const GameId& id, unsigned int score) = 0;
+    virtual ~GameScoreListener() = default;
+};
+
+struct EventStreamStats
+{
+    size_t events = 0;
+    size_t malformed_lines = 0;
+    size_t rejected_rolls = 0;
+    size_t dropped_events = 0;
+    size_t completed_games = 0;
+};
+
+// Parses roll events - one "<lane> <game> <pins>" line per roll - and scores games as rolls arrive.
+// Lines are parsed in place from the fed buffers (only a line split between two buffers is copied).
+// Completed games are reported to the listener and forgotten, so memory is bounded
+// by the number of games in progress.
+class BowlingEventStream
+{
+public:
+    constexpr static size_t max_line_length = 64;
+
+    explicit BowlingEventStream(GameScoreListener& listener, size_t max_active_games = 65'536)
+        : listener_{listener}
+        , max_active_games_{max_active_games}
+    {
+    }
+
+    void feed(std::string_view data)
+    {
+        if (!partial_line_.empty() || skipping_line_)
+        {
+            auto end_of_line = data.find('\n');
+
+            if (end_of_line == std::string_view::npos)
+            {
+                keep_partial_line(data);
+                return;
+            }
+
+            keep_partial_line(data.substr(0, end_of_line));
+
+            if (!skipping_line_)
+                parse_line(partial_line_);
+
+            partial_line_.clear();
+            skipping_line_ = false;
+            data.remove_prefix(end_of_line + 1);
+        }
+
+        for (auto end_of_line = data.find('\n'); end_of_line != std::string_view::npos; end_of_line = data.find('\n'))
+        {
+            parse_line(data.substr(0, end_of_line));
+            data.remove_prefix(end_of_line + 1);
+        }
+
+        keep_partial_line(data);
+    }
+
+    // parses the last line when the stream does not end with a new line
+    void finish()
+    {
+        if (!partial_line_.empty())
+            parse_line(partial_line_);
+
+        partial_line_.clear();
+        skipping_line_ = false;
+    }
+
+    std::optional<unsigned int> score(const GameId& id) const
+    {
+        if (auto game = games_.find(id); game != games_.end())
+            return game->second.score();
+
+        return std::nullopt;
+    }
+
+    template <typename TCallback>
+    void for_each_active_game(TCallback callback) const
+    {
+        for (const auto& [id, game] : games_)
+            callback(id, game.score());
+    }
+
+    size_t active_games() const
+    {
+        return games_.size();
+    }
+
+    const EventStreamStats& stats() const
+    {
+        return stats_;
+    }
+
+private:
+    GameScoreListener& listener_;
+    size_t max_active_games_;
+    std::unordered_map<GameId, CheckedBowlingGame, GameIdHash> games_;
+    std::string partial_line_;
+    bool skipping_line_ = false;
+    EventStreamStats stats_;
+
+    void keep_partial_line(std::string_view data)
+    {
+        if (skipping_line_)
+            return;
+
+        if (partial_line_.size() + data.size() > max_line_length)
+        {
+            ++stats_.malformed_lines;
+            partial_line_.clear();
+            skipping_line_ = true;
+            return;
+        }
+
+        partial_line_.append(data);
+    }
+
+    template <typename T>
+    static bool parse_number(std::string_view& text, T& value)
+    {
+        while (!text.empty() && (text.front() == ' ' || text.front() == '\t'))
+            text.remove_prefix(1);
+
+        auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc{})
+            return false;
+
+        text.remove_prefix(end - text.data());
+        return true;
+    }
+
+    void parse_line(std::string_view line)
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+
+        if (line.empty())
+            return;
+
+        GameId id{};
+        unsigned int pins{};
+
+        if (!parse_number(line, id.lane) || !parse_number(line, id.game) || !parse_number(line, pins)
+            || line.find_first_not_of(" \t") != std::string_view::npos)
+        {
+            ++stats_.malformed_lines;
+            return;
+        }
+
+        roll(id, pins);
+    }
+
+    void roll(const GameId& id, unsigned int pins)
+    {
+        ++stats_.events;
+
+        auto game = games_.find(id);
+
+        if (game == games_.end())
+        {
+            if (games_.size() == max_active_games_)
+            {
+                ++stats_.dropped_events;
+                return;
+            }
+
+            game = games_.emplace(id, CheckedBowlingGame{}).first;
+        }
+
+        if (game->second.roll(pins) != BowlingErrc::ok)
+        {
+            ++stats_.rejected_rolls;
+            return;
+        }
+
+        if (game->second.is_over())
+        {
+            listener_.game_completed(id, game->second.score());
+            games_.erase(game);
+            ++stats_.completed_games;
+        }
+    }
+};
+
+#endif // BOWLING_EVENT_STREAM_HPP
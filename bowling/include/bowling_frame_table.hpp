@@ -0,0 +1,56 @@
+#ifndef BOWLING_FRAME_TABLE_HPP
+#define BOWLING_FRAME_TABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Points of a frame depend only on the three rolls starting the frame:
+// a strike counts the next two rolls, a spare the roll after the frame.
+// The table is indexed by those rolls (4 bits each, as stored by PackedBowlingGame).
+struct FrameScore
+{
+    std::uint8_t points;
+    std::uint8_t rolls;
+};
+
+namespace BowlingFrameTable
+{
+    constexpr unsigned int all_pins_in_frame = 10;
+    constexpr size_t pins_values = 16;
+
+    constexpr size_t index(unsigned int first, unsigned int second, unsigned int third)
+    {
+        return (first << 8) | (second << 4) | third;
+    }
+
+    constexpr std::array<FrameScore, pins_values * pins_values * pins_values> make_table()
+    {
+        std::array<FrameScore, pins_values * pins_values * pins_values> table{};
+
+        for (unsigned int first = 0; first < pins_values; ++first)
+            for (unsigned int second = 0; second < pins_values; ++second)
+                for (unsigned int third = 0; third < pins_values; ++third)
+                {
+                    FrameScore& frame = table[index(first, second, third)];
+
+                    if (first == all_pins_in_frame)
+                        frame = {static_cast<std::uint8_t>(first + second + third), 1};
+                    else if (first + second == all_pins_in_frame)
+                        frame = {static_cast<std::uint8_t>(first + second + third), 2};
+                    else
+                        frame = {static_cast<std::uint8_t>(first + second), 2};
+                }
+
+        return table;
+    }
+
+    inline constexpr auto table = make_table();
+} // namespace BowlingFrameTable
+
+constexpr FrameScore lookup_frame_score(unsigned int first, unsigned int second, unsigned int third)
+{
+    return BowlingFrameTable::table[BowlingFrameTable::index(first, second, third)];
+}
+
+#endif // BOWLING_FRAME_TABLE_HPP
@@ -0,0 +1,181 @@
+#ifndef BOWLING_GAME_HPP
+#define BOWLING_GAME_HPP
+
+#include "bowling_error.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+// Roll policies - chosen at compile time, so trusted replays pay nothing for validation
+struct TrustedRolls
+{
+    constexpr static bool validates_rolls = false;
+};
+
+struct CheckedRolls
+{
+    constexpr static bool validates_rolls = true;
+};
+
+// Score is updated as pins are rolled, so score() and the frame scores
+// of a scoresheet are O(1) reads. The game is usable in constant expressions.
+template <typename TRollPolicy = TrustedRolls>
+class BasicBowlingGame
+{
+    constexpr static size_t frames_count = 10;
+    constexpr static unsigned int all_pins_in_frame = 10;
+
+    std::array<unsigned int, frames_count> cumulative_scores_ = {{}};
+    std::array<unsigned int, frames_count> bonus_rolls_ = {{}};
+    unsigned int score_ = 0;
+    size_t frame_ = 0;
+    size_t scored_frames_ = 0;
+    unsigned int pins_standing_ = all_pins_in_frame;
+    bool is_first_roll_in_frame_ = true;
+
+    constexpr void add_to_frame(size_t frame, unsigned int pins)
+    {
+        score_ += pins;
+
+        for (size_t i = frame; i <= std::min(frame_, frames_count - 1); ++i)
+            cumulative_scores_[i] += pins;
+    }
+
+    // only the last two frames can still wait for bonus rolls
+    constexpr void add_bonus(unsigned int pins)
+    {
+        for (size_t frame = scored_frames_; frame < frame_; ++frame)
+        {
+            if (bonus_rolls_[frame] > 0)
+            {
+                add_to_frame(frame, pins);
+                --bonus_rolls_[frame];
+            }
+        }
+    }
+
+    constexpr void roll_in_frame(unsigned int pins)
+    {
+        add_to_frame(frame_, pins);
+        pins_standing_ -= pins;
+
+        if (is_first_roll_in_frame_)
+        {
+            if (pins_standing_ == 0) // strike
+                end_frame(2);
+            else
+                is_first_roll_in_frame_ = false;
+        }
+        else
+        {
+            end_frame(pins_standing_ == 0 ? 1 : 0); // spare or open frame
+        }
+    }
+
+    constexpr void roll_fill_ball(unsigned int pins)
+    {
+        pins_standing_ -= pins;
+
+        if (pins_standing_ == 0)
+            pins_standing_ = all_pins_in_frame;
+    }
+
+    constexpr void end_frame(unsigned int bonus_rolls)
+    {
+        bonus_rolls_[frame_] = bonus_rolls;
+        pins_standing_ = all_pins_in_frame;
+        is_first_roll_in_frame_ = true;
+
+        if (++frame_ < frames_count)
+            cumulative_scores_[frame_] = cumulative_scores_[frame_ - 1];
+    }
+
+    constexpr void update_scored_frames()
+    {
+        while (scored_frames_ < frame_ && bonus_rolls_[scored_frames_] == 0)
+            ++scored_frames_;
+    }
+
+public:
+    constexpr unsigned int score() const
+    {
+        return score_;
+    }
+
+    constexpr BowlingErrc roll(unsigned int pins)
+    {
+        if constexpr (TRollPolicy::validates_rolls)
+        {
+            if (is_over())
+                return BowlingErrc::game_over;
+
+            if (pins > pins_standing_)
+                return BowlingErrc::too_many_pins;
+        }
+
+        add_bonus(pins);
+
+        if (frame_ < frames_count)
+            roll_in_frame(pins);
+        else
+            roll_fill_ball(pins);
+
+        update_scored_frames();
+
+        return BowlingErrc::ok;
+    }
+
+    constexpr bool is_over() const
+    {
+        return frame_ == frames_count && bonus_rolls_[frames_count - 1] == 0;
+    }
+
+    constexpr unsigned int pins_standing() const
+    {
+        return pins_standing_;
+    }
+
+    // points of a single frame including bonuses rolled so far - 0 for frames not played yet or out of the game
+    constexpr unsigned int frame_score(size_t frame) const
+    {
+        if (frame >= frames_count || frame > frame_)
+            return 0;
+
+        return cumulative_scores_[frame] - (frame == 0 ? 0 : cumulative_scores_[frame - 1]);
+    }
+
+    // running total up to the frame - as written on a scoresheet
+    constexpr unsigned int cumulative_score(size_t frame) const
+    {
+        return (frame >= frames_count || frame > frame_) ? 0 : cumulative_scores_[frame];
+    }
+
+    // number of frames that will not get more points
+    constexpr size_t scored_frames() const
+    {
+        return scored_frames_;
+    }
+
+    // index of the frame being rolled - 10 when only fill balls are left
+    constexpr size_t frame() const
+    {
+        return frame_;
+    }
+
+    constexpr bool is_first_roll_in_frame() const
+    {
+        return is_first_roll_in_frame_;
+    }
+
+    // rolls still counted as a bonus of a finished frame (fill balls left for the tenth frame)
+    constexpr unsigned int bonus_rolls(size_t frame) const
+    {
+        return frame < frame_ ? bonus_rolls_[frame] : 0;
+    }
+};
+
+using BowlingGame = BasicBowlingGame<TrustedRolls>;
+using CheckedBowlingGame = BasicBowlingGame<CheckedRolls>;
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef BOWLING_GAME_GENERATOR_HPP
+#define BOWLING_GAME_GENERATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Random legal games - every roll knocks down at most the standing pins and
+// a game has exactly the rolls needed to finish it (fill balls included).
+// Knocking down all standing pins is drawn separately, so strikes and spares
+// are common enough to exercise bonuses.
+// The rules of frames are encoded here, independently of the scorers the games are used to test.
+class BowlingGameGenerator
+{
+public:
+    constexpr static size_t frames_count = 10;
+    constexpr static unsigned int all_pins = 10;
+
+    explicit BowlingGameGenerator(std::uint64_t seed, double all_pins_probability = 0.3)
+        : rnd_{seed}
+        , all_pins_{all_pins_probability}
+    {
+    }
+
+    std::vector<unsigned int> next_game()
+    {
+        std::vector<unsigned int> rolls;
+
+        for (size_t frame = 0; frame < frames_count - 1; ++frame)
+        {
+            const unsigned int first = roll(rolls, all_pins);
+
+            if (first != all_pins)
+                roll(rolls, all_pins - first);
+        }
+
+        // last frame - a strike earns two fill balls, a spare one
+        const unsigned int first = roll(rolls, all_pins);
+
+        if (first == all_pins)
+        {
+            const unsigned int fill = roll(rolls, all_pins);
+            roll(rolls, fill == all_pins ? all_pins : all_pins - fill);
+        }
+        else if (first + roll(rolls, all_pins - first) == all_pins)
+        {
+            roll(rolls, all_pins);
+        }
+
+        return rolls;
+    }
+
+private:
+    std::mt19937_64 rnd_;
+    std::bernoulli_distribution all_pins_;
+
+    unsigned int roll(std::vector<unsigned int>& rolls, unsigned int standing)
+    {
+        const unsigned int pins = all_pins_(rnd_) ? standing : std::uniform_int_distribution<unsigned int>{0, standing}(rnd_);
+        rolls.push_back(pins);
+
+        return pins;
+    }
+};
+
+#endif // BOWLING_GAME_GENERATOR_HPP
@@ -0,0 +1,172 @@
+#ifndef BOWLING_GAME_POOL_HPP
+#define BOWLING_GAME_POOL_HPP
+
+#include "bowling_game.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <vector>
+
+struct GameHandle
+{
+    std::uint32_t index;
+    std::uint32_t generation;
+
+    bool operator==(const GameHandle& other) const = default;
+};
+
+// Games recycled in place - released slots go to a free list and are reused by acquire(),
+// so a warmed-up pool does not allocate. A handle stays valid until its game is released;
+// a handle of a released game is detected by the generation stored in the slot.
+//
+// The pool is allocator-aware: with a std::pmr::monotonic_buffer_resource shared by the pool
+// and other pmr containers (players, lanes, history) the state of a whole tournament is
+// freed at once by releasing the resource.
+template <typename TGame = CheckedBowlingGame>
+class BasicGamePool
+{
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    BasicGamePool() = default;
+
+    explicit BasicGamePool(const allocator_type& allocator)
+        : slots_(allocator)
+        , free_slots_(allocator)
+    {
+    }
+
+    explicit BasicGamePool(size_t capacity, const allocator_type& allocator = {})
+        : BasicGamePool(allocator)
+    {
+        reserve(capacity);
+    }
+
+    BasicGamePool(BasicGamePool&& other) = default;
+
+    BasicGamePool(BasicGamePool&& other, const allocator_type& allocator)
+        : slots_(std::move(other.slots_), allocator)
+        , free_slots_(std::move(other.free_slots_), allocator)
+    {
+    }
+
+    BasicGamePool& operator=(BasicGamePool&& other) = default;
+
+    allocator_type get_allocator() const
+    {
+        return slots_.get_allocator();
+    }
+
+    void reserve(size_t capacity)
+    {
+        slots_.reserve(capacity);
+        free_slots_.reserve(capacity);
+    }
+
+    // new game - in a released slot if there is one
+    GameHandle acquire()
+    {
+        if (free_slots_.empty())
+        {
+            slots_.push_back(Slot{});
+            return GameHandle{static_cast<std::uint32_t>(slots_.size() - 1), 0};
+        }
+
+        const std::uint32_t index = free_slots_.back();
+        free_slots_.pop_back();
+
+        Slot& slot = slots_[index];
+        slot.game = TGame{};
+        slot.is_used = true;
+
+        return GameHandle{index, slot.generation};
+    }
+
+    void release(GameHandle handle)
+    {
+        check(handle);
+
+        Slot& slot = slots_[handle.index];
+
+        slot.is_used = false;
+        ++slot.generation;
+        free_slots_.push_back(handle.index);
+    }
+
+    // starts the game of the handle from scratch
+    void reset(GameHandle handle)
+    {
+        check(handle);
+        slots_[handle.index].game = TGame{};
+    }
+
+    bool contains(GameHandle handle) const
+    {
+        return handle.index < slots_.size() && slots_[handle.index].is_used && slots_[handle.index].generation == handle.generation;
+    }
+
+    // references are invalidated when the pool grows - handles are not
+    TGame& operator[](GameHandle handle)
+    {
+        check(handle);
+        return slots_[handle.index].game;
+    }
+
+    const TGame& operator[](GameHandle handle) const
+    {
+        check(handle);
+        return slots_[handle.index].game;
+    }
+
+    size_t size() const
+    {
+        return slots_.size() - free_slots_.size();
+    }
+
+    size_t capacity() const
+    {
+        return slots_.capacity();
+    }
+
+    // releases all games at once - all handles become invalid
+    void clear()
+    {
+        free_slots_.clear();
+
+        for (auto index = static_cast<std::uint32_t>(slots_.size()); index-- > 0;)
+        {
+            Slot& slot = slots_[index];
+
+            if (slot.is_used)
+            {
+                slot.is_used = false;
+                ++slot.generation;
+            }
+
+            free_slots_.push_back(index);
+        }
+    }
+
+private:
+    struct Slot
+    {
+        TGame game{};
+        std::uint32_t generation = 0;
+        bool is_used = true;
+    };
+
+    std::pmr::vector<Slot> slots_;
+    std::pmr::vector<std::uint32_t> free_slots_;
+
+    void check(GameHandle handle) const
+    {
+        if (!contains(handle))
+            throw std::invalid_argument("game handle is not valid");
+    }
+};
+
+using GamePool = BasicGamePool<CheckedBowlingGame>;
+
+#endif // BOWLING_GAME_POOL_HPP
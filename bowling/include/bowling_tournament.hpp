@@ -0,0 +1,144 @@
+#ifndef BOWLING_TOURNAMENT_HPP
+#define BOWLING_TOURNAMENT_HPP
+
+#include "bowling_game.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+struct LeaderboardEntry
+{
+    size_t lane;
+    size_t player;
+    unsigned int score;
+
+    bool operator==(const LeaderboardEntry& other) const = default;
+};
+
+// Games of all players of all lanes.
+// Rolls from different lanes never contend: each lane has its own lock (on its own cache line)
+// and a roll touches only the state of its lane. After every roll the player's score is
+// published to an atomic, so the leaderboard is built from those atomics without taking
+// any lock - readers never block writers and writers never wait for readers.
+class BowlingTournament
+{
+public:
+    BowlingTournament(size_t lanes_count, size_t players_per_lane)
+        : lanes_count_{lanes_count}
+        , players_per_lane_{players_per_lane}
+        , lanes_{std::make_unique<Lane[]>(lanes_count)}
+    {
+        for (size_t lane = 0; lane < lanes_count_; ++lane)
+        {
+            lanes_[lane].games.resize(players_per_lane_);
+            lanes_[lane].scores = std::make_unique<std::atomic<unsigned int>[]>(players_per_lane_);
+        }
+    }
+
+    size_t lanes_count() const
+    {
+        return lanes_count_;
+    }
+
+    size_t players_per_lane() const
+    {
+        return players_per_lane_;
+    }
+
+    // safe to call concurrently - typically from one thread per lane
+    BowlingErrc roll(size_t lane, size_t player, unsigned int pins)
+    {
+        check_player(lane, player);
+
+        Lane& l = lanes_[lane];
+        std::lock_guard lk{l.mtx};
+
+        CheckedBowlingGame& game = l.games[player];
+
+        if (auto result = game.roll(pins); result != BowlingErrc::ok)
+            return result;
+
+        l.scores[player].store(game.score(), std::memory_order_release);
+
+        return BowlingErrc::ok;
+    }
+
+    void start_new_game(size_t lane, size_t player)
+    {
+        check_player(lane, player);
+
+        Lane& l = lanes_[lane];
+        std::lock_guard lk{l.mtx};
+
+        l.games[player] = CheckedBowlingGame{};
+        l.scores[player].store(0, std::memory_order_release);
+    }
+
+    bool is_over(size_t lane, size_t player) const
+    {
+        check_player(lane, player);
+
+        Lane& l = lanes_[lane];
+        std::lock_guard lk{l.mtx};
+
+        return l.games[player].is_over();
+    }
+
+    // never blocks
+    unsigned int score(size_t lane, size_t player) const
+    {
+        check_player(lane, player);
+
+        return lanes_[lane].scores[player].load(std::memory_order_acquire);
+    }
+
+    // never blocks - every entry is a score published by a completed roll,
+    // ties are ordered by lane and player
+    std::vector<LeaderboardEntry> top(size_t k) const
+    {
+        std::vector<LeaderboardEntry> entries;
+        entries.reserve(lanes_count_ * players_per_lane_);
+
+        for (size_t lane = 0; lane < lanes_count_; ++lane)
+            for (size_t player = 0; player < players_per_lane_; ++player)
+                entries.push_back({lane, player, lanes_[lane].scores[player].load(std::memory_order_acquire)});
+
+        k = std::min(k, entries.size());
+
+        std::partial_sort(entries.begin(), entries.begin() + k, entries.end(), [](const auto& a, const auto& b) {
+            if (a.score != b.score)
+                return a.score > b.score;
+
+            return a.lane != b.lane ? a.lane < b.lane : a.player < b.player;
+        });
+
+        entries.resize(k);
+
+        return entries;
+    }
+
+private:
+    struct alignas(64) Lane
+    {
+        mutable std::mutex mtx;
+        std::vector<CheckedBowlingGame> games;
+        std::unique_ptr<std::atomic<unsigned int>[]> scores;
+    };
+
+    size_t lanes_count_;
+    size_t players_per_lane_;
+    std::unique_ptr<Lane[]> lanes_;
+
+    void check_player(size_t lane, size_t player) const
+    {
+        if (lane >= lanes_count_ || player >= players_per_lane_)
+            throw std::out_of_range("no such lane or player in the tournament");
+    }
+};
+
+#endif // BOWLING_TOURNAMENT_HPP
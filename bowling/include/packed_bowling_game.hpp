@@ -0,0 +1,70 @@
+#ifndef PACKED_BOWLING_GAME_HPP
+#define PACKED_BOWLING_GAME_HPP
+
+#include "bowling_error.hpp"
+#include "bowling_frame_table.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Game stored as 4 bits per roll - 12 bytes in total.
+// Rolls are stored as they come (as in TrustedRolls mode of BowlingGame)
+// and the score is calculated directly from the packed rolls
+// with one frame table lookup per frame.
+class PackedBowlingGame
+{
+public:
+    constexpr static size_t max_rolls = 21;
+
+    constexpr BowlingErrc roll(unsigned int pins)
+    {
+        if (pins > all_pins_in_frame)
+            return BowlingErrc::too_many_pins;
+
+        if (rolls_count_ == max_rolls)
+            return BowlingErrc::game_over;
+
+        rolls_[rolls_count_ / 2] |= static_cast<std::uint8_t>(pins << (4 * (rolls_count_ % 2)));
+        ++rolls_count_;
+
+        return BowlingErrc::ok;
+    }
+
+    constexpr unsigned int pins(size_t roll_index) const
+    {
+        return (rolls_[roll_index / 2] >> (4 * (roll_index % 2))) & 0x0F;
+    }
+
+    constexpr size_t rolls_count() const
+    {
+        return rolls_count_;
+    }
+
+    constexpr unsigned int score() const
+    {
+        unsigned int result = 0;
+        size_t roll_index = 0;
+
+        for (size_t i = 0; i < frames_count; ++i)
+        {
+            auto [points, rolls] = lookup_frame_score(pins(roll_index), pins(roll_index + 1), pins(roll_index + 2));
+
+            result += points;
+            roll_index += rolls;
+        }
+
+        return result;
+    }
+
+private:
+    constexpr static size_t frames_count = 10;
+    constexpr static unsigned int all_pins_in_frame = 10;
+
+    std::array<std::uint8_t, (max_rolls + 1) / 2> rolls_ = {};
+    std::uint8_t rolls_count_ = 0;
+};
+
+static_assert(sizeof(PackedBowlingGame) == 12);
+
+#endif // PACKED_BOWLING_GAME_HPP
@@ -0,0 +1,181 @@
+#include "document.hpp"
+#include "text_search.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    size_t sink = 0;
+
+    struct Edit
+    {
+        size_t pos;
+        size_t count;
+        string text;
+    };
+
+    // edits are generated against the length the document will have when they are applied
+    vector<Edit> make_edits(size_t count, size_t document_size)
+    {
+        mt19937_64 rnd{2024};
+        vector<Edit> edits;
+        edits.reserve(count);
+
+        size_t size = document_size;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            Edit edit;
+            edit.pos = uniform_int_distribution<size_t>{0, size}(rnd);
+            edit.count = min(size - edit.pos, uniform_int_distribution<size_t>{0, 16}(rnd));
+            edit.text = string(uniform_int_distribution<size_t>{0, 16}(rnd), 'x');
+
+            size = size - edit.count + edit.text.size();
+            edits.push_back(move(edit));
+        }
+
+        return edits;
+    }
+
+    // full memmove per edit is slow on large texts - fewer edits are timed there
+    size_t edits_count(size_t size)
+    {
+        return clamp<size_t>(20'000'000'000 / max<size_t>(size, 1), 100, 100'000);
+    }
+
+    template <typename Operation>
+    double ns_per_op(size_t ops, Operation operation)
+    {
+        auto start = chrono::steady_clock::now();
+
+        for (size_t i = 0; i < ops; ++i)
+            operation(i);
+
+        chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+        return elapsed.count() / ops;
+    }
+
+    void report(const char* scenario, const char* storage, size_t size, double ns)
+    {
+        printf("%-16s %-24s %12zu %14.1f\n", scenario, storage, size, ns);
+    }
+
+    template <typename Conversion>
+    void report_case_conversion(const char* method, string text, Conversion conversion)
+    {
+        auto start = chrono::steady_clock::now();
+        conversion(text);
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+        printf("%-16s %-40s %12zu %10.2f\n", "to-upper", method, text.size(), text.size() / elapsed.count() / 1e9);
+        sink += static_cast<unsigned char>(text.back());
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const size_t max_size = (argc > 1) ? strtoull(argv[1], nullptr, 10) : 64'000'000;
+
+    const vector<size_t> sizes = {1'000, 100'000, 1'000'000, 16'000'000, 64'000'000, 500'000'000};
+
+    printf("%-16s %-24s %12s %14s\n", "scenario", "storage", "size", "ns/edit");
+
+    for (size_t size : sizes)
+    {
+        if (size > max_size)
+            break;
+
+        const string initial_text(size, 'a');
+        const auto edits = make_edits(edits_count(size), size);
+
+        string text = initial_text;
+        report("random-replace", "std::string", size, ns_per_op(edits.size(), [&](size_t i) {
+            text.replace(edits[i].pos, edits[i].count, edits[i].text);
+        }));
+        sink += text.size();
+
+        Document doc{initial_text};
+        report("random-replace", "Document (piece table)", size, ns_per_op(edits.size(), [&](size_t i) {
+            doc.replace(edits[i].pos, edits[i].count, edits[i].text);
+        }));
+        sink += doc.length();
+    }
+
+    string text;
+    while (text.size() < max_size)
+        text += "Lorem ipsum dolor sit amet, consectetur adipiscing elit. ";
+
+    printf("\n%-16s %-40s %12s %10s\n", "scenario", "method", "size", "GB/s");
+
+    report_case_conversion("std::transform + std::toupper", text, [](string& t) {
+        transform(t.begin(), t.end(), t.begin(), [](unsigned char c) { return static_cast<char>(toupper(c)); });
+    });
+    report_case_conversion("CaseConversion::convert", text, [](string& t) { CaseConversion::convert(t, CaseConversion::Case::upper); });
+    report_case_conversion("CaseConversion::convert_parallel", text, [](string& t) {
+        CaseConversion::convert_parallel(t, CaseConversion::Case::upper);
+    });
+
+    Document doc{text};
+    auto start = chrono::steady_clock::now();
+    doc.to_upper();
+    chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+    printf("%-16s %-40s %12zu %10.2f\n", "to-upper", "Document::to_upper", doc.length(), doc.length() / elapsed.count() / 1e9);
+
+    {
+        string lines;
+        while (lines.size() < max_size)
+            lines += "Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n";
+
+        Document doc{lines};
+        const auto edits = make_edits(10'000, lines.size());
+        for (const auto& edit : edits)
+            doc.replace(edit.pos, edit.count, edit.text);
+
+        const size_t line_count = doc.line_count();
+        printf("\n%-16s %-24s %12s %14s\n", "scenario", "storage", "size", "ns/lookup");
+        report("line-start", "Document (line index)", doc.length(), ns_per_op(100'000, [&](size_t i) {
+            sink += doc.offset_of(TextPosition{i * 7919 % line_count, 0});
+        }));
+    }
+
+    printf("\n%-16s %-40s %12s %10s\n", "scenario", "method", "size", "GB/s");
+
+    auto report_search = [&](const char* method, auto search) {
+        auto start = chrono::steady_clock::now();
+        const size_t matches = search();
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+        printf("%-16s %-40s %12zu %10.2f\n", "find-all", method, text.size(), text.size() / elapsed.count() / 1e9);
+        sink += matches;
+    };
+
+    const string pattern = "adipiscing";
+
+    report_search("std::string::find", [&] {
+        size_t matches = 0;
+        for (size_t pos = text.find(pattern); pos != string::npos; pos = text.find(pattern, pos + pattern.size()))
+            ++matches;
+        return matches;
+    });
+
+    Document searched{text};
+    report_search("TextSearch::find_all", [&] { return TextSearch::find_all(searched, pattern).size(); });
+    report_search("TextSearch::find_all (no matches)", [&] { return TextSearch::find_all(searched, "magna aliqua").size() + 1; });
+
+    for (size_t pos = 0; pos < searched.length(); pos += searched.length() / 1000 + 1)
+        searched.insert(pos, "#");
+    report_search("TextSearch::find_all (1000 pieces)", [&] { return TextSearch::find_all(searched, pattern).size(); });
+
+    report_search("TextSearch::replace_all", [&] { return TextSearch::replace_all(searched, pattern, "ADIPISCING"); });
+
+    return sink == 0 ? 1 : 0;
+}
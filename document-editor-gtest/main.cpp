@@ -11,11 +11,18 @@ int main_1()
 {
     Terminal terminal;
     Document doc;
+    History history{doc};
 
-    Application app{terminal};
+    Application app{terminal, std::make_shared<WorkerExecutor>()};
 
     app.add_command(PrintCmd::ID, std::make_shared<PrintCmd>(doc, terminal));
-    app.add_command(AddText::ID, std::make_shared<AddText>(doc, terminal));
+    app.add_command(AddText::ID, std::make_shared<UndoableCmd>(std::make_shared<AddText>(doc, terminal), history));
+    app.add_command(OpenCmd::ID, std::make_shared<UndoableCmd>(std::make_shared<OpenCmd>(doc, terminal), history));
+    app.add_command(SaveCmd::ID, std::make_shared<SaveCmd>(doc, terminal));
+    app.add_command(FindCmd::ID, std::make_shared<FindCmd>(doc, terminal));
+    app.add_command(ReplaceCmd::ID, std::make_shared<UndoableCmd>(std::make_shared<ReplaceCmd>(doc, terminal), history));
+    app.add_command(UndoCmd::ID, std::make_shared<UndoCmd>(history, terminal));
+    app.add_command(RedoCmd::ID, std::make_shared<RedoCmd>(history, terminal));
 
     return app.run();
 }
@@ -23,14 +30,25 @@ int main_1()
 int main()
 {
     Terminal terminal;
+    Document doc;
+    History history{doc};
 
     auto injector = di::make_injector(
-        di::bind<Console>.to(terminal)
+        di::bind<Console>.to(terminal),
+        di::bind<Document>.to(doc),
+        di::bind<History>.to(history),
+        di::bind<CommandExecutor>.to<WorkerExecutor>()
     );
 
     auto app = injector.create<Application>();
     app.add_command(PrintCmd::ID, injector.create<std::shared_ptr<PrintCmd>>());
-    app.add_command(AddText::ID, injector.create<std::shared_ptr<AddText>>());
+    app.add_command(AddText::ID, std::make_shared<UndoableCmd>(injector.create<std::shared_ptr<AddText>>(), history));
+    app.add_command(OpenCmd::ID, std::make_shared<UndoableCmd>(injector.create<std::shared_ptr<OpenCmd>>(), history));
+    app.add_command(SaveCmd::ID, injector.create<std::shared_ptr<SaveCmd>>());
+    app.add_command(FindCmd::ID, injector.create<std::shared_ptr<FindCmd>>());
+    app.add_command(ReplaceCmd::ID, std::make_shared<UndoableCmd>(injector.create<std::shared_ptr<ReplaceCmd>>(), history));
+    app.add_command(UndoCmd::ID, injector.create<std::shared_ptr<UndoCmd>>());
+    app.add_command(RedoCmd::ID, injector.create<std::shared_ptr<RedoCmd>>());
 
     app.run();
 }
\ No newline at end of file
@@ -1,25 +1,40 @@
 #ifndef APPLICATION_HPP
 #define APPLICATION_HPP
 
+#include "case_conversion.hpp"
 #include "command.hpp"
+#include "command_executor.hpp"
 #include "console.hpp"
 
+#include <deque>
+#include <exception>
 #include <map>
+#include <memory>
 
-std::string to_lower(std::string text)
+inline std::string to_lower(std::string text)
 {
-    std::transform(text.begin(), text.end(), text.begin(), [](auto c) { return std::tolower(c); });
+    CaseConversion::convert(text, CaseConversion::Case::lower);
     return text;
 }
 
+// Commands are passed to the executor - with an InlineExecutor (default) they run synchronously,
+// with a WorkerExecutor the input is read while they run in the background.
+// Arguments of commands are read in the input thread - only the prepared work is submitted.
+// Failures of submitted commands are printed before the next prompt (and before exit).
 class Application
 {
     Console& console_;
+    std::shared_ptr<CommandExecutor> executor_;
     std::map<std::string, std::shared_ptr<Command>> commands_;
+    std::deque<CommandTicket> submitted_; // in the order of submission
 
 public:
     Application(Console& console)
-        : console_(console)
+        : Application(console, std::make_shared<InlineExecutor>())
+    { }
+
+    Application(Console& console, std::shared_ptr<CommandExecutor> executor)
+        : console_(console), executor_(std::move(executor))
     { }
 
     int run()
@@ -28,17 +43,25 @@ public:
 
         while (true)
         {
+            report_finished();
+
             console_.print("> Enter a command:");
 
             std::string line = to_lower(console_.get_line());
 
             if (line == Commands::EXIT)
+            {
+                executor_->drain();
+                report_finished();
                 return 0;
+            }
 
             if (auto cmd_entry = commands_.find(line); cmd_entry != commands_.end())
             {
                 const auto& [name, command] = *cmd_entry;
-                command->execute();
+
+                auto prepared = command->prepare();
+                submit(prepared ? std::move(prepared) : command);
             }
             else
             {
@@ -51,6 +74,42 @@ public:
     {
         commands_.emplace(name, cmd);
     }
+
+private:
+    void submit(std::shared_ptr<Command> cmd)
+    {
+        try
+        {
+            submitted_.push_back(executor_->submit(std::move(cmd)));
+        }
+        catch (const std::exception& e) // thrown by an InlineExecutor
+        {
+            print_error(e);
+        }
+    }
+
+    // stops at the first command that is still queued or running
+    void report_finished()
+    {
+        while (!submitted_.empty() && submitted_.front().finished())
+        {
+            try
+            {
+                submitted_.front().wait();
+            }
+            catch (const std::exception& e)
+            {
+                print_error(e);
+            }
+
+            submitted_.pop_front();
+        }
+    }
+
+    void print_error(const std::exception& e)
+    {
+        console_.print(std::string{"Error: "} + e.what());
+    }
 };
 
 #endif // APPLICATION_HPP
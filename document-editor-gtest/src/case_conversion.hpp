@@ -0,0 +1,198 @@
+#ifndef CASE_CONVERSION_HPP
+#define CASE_CONVERSION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CASE_CONVERSION_SSE2
+#endif
+
+// Locale independent case conversion of UTF-8 text in place.
+// ASCII is converted 16 bytes at a time (letters are found with a range mask, no branches per byte).
+// Two-byte UTF-8 letters of Latin-1, Latin Extended-A, Greek and Cyrillic are converted
+// on a slow path - their other case has the same length in UTF-8, so the text never moves.
+// Other characters and invalid UTF-8 are left as they are.
+namespace CaseConversion
+{
+    enum class Case
+    {
+        upper,
+        lower
+    };
+
+    namespace Detail
+    {
+        constexpr bool is_ascii(unsigned char c)
+        {
+            return c < 0x80;
+        }
+
+        constexpr bool is_continuation(unsigned char c)
+        {
+            return (c & 0xC0) == 0x80;
+        }
+
+        constexpr char convert_ascii_char(char c, Case target)
+        {
+            const char first = target == Case::upper ? 'a' : 'A';
+
+            return (c >= first && c <= first + 25) ? static_cast<char>(c ^ 0x20) : c;
+        }
+
+        // Latin Extended-A: pairs of upper and lower case letters on adjacent code points
+        constexpr bool is_even_upper_pair(char32_t cp)
+        {
+            return (cp >= 0x100 && cp <= 0x12F) || (cp >= 0x132 && cp <= 0x137) || (cp >= 0x14A && cp <= 0x177);
+        }
+
+        constexpr bool is_odd_upper_pair(char32_t cp)
+        {
+            return (cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E);
+        }
+
+        constexpr char32_t to_upper(char32_t cp)
+        {
+            if ((cp >= 0xE0 && cp <= 0xFE && cp != 0xF7) || (cp >= 0x3B1 && cp <= 0x3C9 && cp != 0x3C2) || (cp >= 0x430 && cp <= 0x44F))
+                return cp - 0x20;
+            if (cp == 0xFF)
+                return 0x178;
+            if (is_even_upper_pair(cp) && cp % 2 == 1)
+                return cp - 1;
+            if (is_odd_upper_pair(cp) && cp % 2 == 0)
+                return cp - 1;
+            if (cp == 0x3C2) // final sigma
+                return 0x3A3;
+            if (cp >= 0x450 && cp <= 0x45F)
+                return cp - 0x50;
+
+            return cp;
+        }
+
+        constexpr char32_t to_lower(char32_t cp)
+        {
+            if ((cp >= 0xC0 && cp <= 0xDE && cp != 0xD7) || (cp >= 0x391 && cp <= 0x3A9 && cp != 0x3A2) || (cp >= 0x410 && cp <= 0x42F))
+                return cp + 0x20;
+            if (cp == 0x178)
+                return 0xFF;
+            if (is_even_upper_pair(cp) && cp % 2 == 0)
+                return cp + 1;
+            if (is_odd_upper_pair(cp) && cp % 2 == 1)
+                return cp + 1;
+            if (cp >= 0x400 && cp <= 0x40F)
+                return cp + 0x50;
+
+            return cp;
+        }
+
+        // converts ASCII from pos - returns position of the first non-ASCII byte
+        inline size_t convert_ascii(std::span<char> text, size_t pos, Case target)
+        {
+#ifdef CASE_CONVERSION_SSE2
+            // bytes of the letters to change are moved to the bottom of the signed range,
+            // so a single signed comparison finds them
+            const __m128i bias = _mm_set1_epi8(static_cast<char>(0x80 - (target == Case::upper ? 'a' : 'A')));
+            const __m128i limit = _mm_set1_epi8(static_cast<char>(0x80 + 26));
+            const __m128i case_bit = _mm_set1_epi8(0x20);
+
+            for (; pos + 16 <= text.size(); pos += 16)
+            {
+                char* block = text.data() + pos;
+                const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+
+                if (_mm_movemask_epi8(bytes) != 0)
+                    break;
+
+                const __m128i is_letter = _mm_cmplt_epi8(_mm_add_epi8(bytes, bias), limit);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(block), _mm_xor_si128(bytes, _mm_and_si128(is_letter, case_bit)));
+            }
+#endif
+            for (; pos < text.size() && is_ascii(text[pos]); ++pos)
+                text[pos] = convert_ascii_char(text[pos], target);
+
+            return pos;
+        }
+
+        // converts a single character starting with a non-ASCII byte - returns position after it
+        inline size_t convert_multibyte(std::span<char> text, size_t pos, Case target)
+        {
+            const auto lead = static_cast<unsigned char>(text[pos]);
+
+            if (lead >= 0xC2 && lead <= 0xDF && pos + 1 < text.size() && is_continuation(text[pos + 1]))
+            {
+                const char32_t cp = ((lead & 0x1F) << 6) | (static_cast<unsigned char>(text[pos + 1]) & 0x3F);
+                const char32_t converted = target == Case::upper ? to_upper(cp) : to_lower(cp);
+
+                text[pos] = static_cast<char>(0xC0 | (converted >> 6));
+                text[pos + 1] = static_cast<char>(0x80 | (converted & 0x3F));
+
+                return pos + 2;
+            }
+
+            // other characters are skipped - continuation bytes never start an ASCII run
+            for (++pos; pos < text.size() && is_continuation(text[pos]); ++pos)
+                ;
+
+            return pos;
+        }
+    } // namespace Detail
+
+    inline void convert(std::span<char> text, Case target)
+    {
+        for (size_t pos = 0; pos < text.size();)
+        {
+            pos = Detail::convert_ascii(text, pos, target);
+
+            if (pos < text.size())
+                pos = Detail::convert_multibyte(text, pos, target);
+        }
+    }
+
+    constexpr size_t parallel_threshold = 1 << 20;
+
+    // large texts are split between threads - never in the middle of a UTF-8 character
+    inline void convert_parallel(std::span<char> text, Case target, size_t thread_count = std::thread::hardware_concurrency())
+    {
+        thread_count = std::clamp<size_t>(thread_count, 1, text.size() / parallel_threshold + 1);
+
+        if (thread_count == 1)
+        {
+            convert(text, target);
+            return;
+        }
+
+        std::vector<std::jthread> threads;
+        threads.reserve(thread_count);
+
+        size_t first = 0;
+        for (size_t i = 1; i <= thread_count; ++i)
+        {
+            size_t last = text.size() * i / thread_count;
+            while (last < text.size() && Detail::is_continuation(text[last]))
+                ++last;
+
+            if (first < last)
+                threads.emplace_back([chunk = text.subspan(first, last - first), target] { convert(chunk, target); });
+
+            first = last;
+        }
+    }
+
+    inline void to_upper(std::string& text)
+    {
+        convert_parallel(text, Case::upper);
+    }
+
+    inline void to_lower(std::string& text)
+    {
+        convert_parallel(text, Case::lower);
+    }
+} // namespace CaseConversion
+
+#endif // CASE_CONVERSION_HPP
@@ -1,7 +1,8 @@
 #ifndef CLIPBOARD_HPP
 #define CLIPBOARD_HPP
 
-#include <mutex>
+#include <atomic>
+#include <memory>
 #include <string>
 
 class Clipboard
@@ -13,31 +14,40 @@ public:
 };
 
 
+// Content is immutable and published by atomically swapping a shared pointer - readers take a reference
+// counted snapshot without copying the text. The atomic shared pointer is not lock-free (libstdc++
+// guards it with an internal spinlock), but the text is never copied or changed under the lock.
 class SharedClipboard : public Clipboard
 {
-    std::string content_;
-    mutable std::mutex content_mtx_;
+    std::atomic<std::shared_ptr<const std::string>> content_{std::make_shared<const std::string>()};
 
 public:
-    SharedClipboard& instance()
+    static SharedClipboard& instance()
     {
         static SharedClipboard unique_instance;
 
         return unique_instance;
     }
 
-    std::string content() const override
+    // valid and unchanged regardless of later changes of the clipboard
+    std::shared_ptr<const std::string> snapshot() const
     {
-        std::lock_guard<std::mutex> lk{content_mtx_};
+        return content_.load(std::memory_order_acquire);
+    }
 
-        return content_;
+    std::string content() const override
+    {
+        return *snapshot();
     }
 
     void set_content(const std::string& content) override
     {
-        std::lock_guard<std::mutex> lk{content_mtx_};
+        set_content(std::string{content});
+    }
 
-        content_ = content;
+    void set_content(std::string&& content)
+    {
+        content_.store(std::make_shared<const std::string>(std::move(content)), std::memory_order_release);
     }
 };
 
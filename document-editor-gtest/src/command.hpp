@@ -4,14 +4,53 @@
 #include "clipboard.hpp"
 #include "console.hpp"
 #include "document.hpp"
+#include "document_file.hpp"
+#include "history.hpp"
+#include "text_search.hpp"
+#include <exception>
+#include <functional>
 #include <memory>
 #include <stack>
+#include <string_view>
+#include <vector>
 
 class Command
 {
 public:
     virtual ~Command() = default;
     virtual void execute() = 0;
+
+    // reads arguments of the command from the console (in the input thread) and returns the work
+    // to be done with them - nullptr when the command has no arguments and is executed itself
+    virtual std::shared_ptr<Command> prepare()
+    {
+        return nullptr;
+    }
+};
+
+// Work of a command with its arguments already read
+class FunctionCmd : public Command
+{
+    std::function<void()> work_;
+public:
+    explicit FunctionCmd(std::function<void()> work) : work_(std::move(work)) {}
+
+    void execute() override
+    {
+        work_();
+    }
+};
+
+// Command with arguments - executing it reads them and does the work at once
+class InteractiveCmd : public Command
+{
+public:
+    std::shared_ptr<Command> prepare() override = 0;
+
+    void execute() override
+    {
+        prepare()->execute();
+    }
 };
 
 namespace Commands
@@ -31,11 +70,18 @@ public:
 
     void execute() override
     {
-        console_.print("[" + doc_.text() + "]");
+        std::vector<std::string_view> fragments{"["};
+
+        for (auto chunk : doc_.chunks())
+            fragments.push_back(chunk);
+
+        fragments.push_back("]");
+
+        console_.print_fragments(fragments);
     }
 };
 
-class AddText : public Command
+class AddText : public InteractiveCmd
 {
     Document& doc_;
     Console& console_;
@@ -44,11 +90,169 @@ public:
 
     AddText(Document& doc, Console& console) : doc_(doc), console_(console) {}
 
-    void execute() override
+    std::shared_ptr<Command> prepare() override
     {
         console_.print("> Enter text:");
         std::string text = console_.get_line();
-        doc_.add_text(text);
+
+        return std::make_shared<FunctionCmd>([&doc = doc_, text = std::move(text)] { doc.add_text(text); });
+    }
+};
+
+class OpenCmd : public InteractiveCmd
+{
+    Document& doc_;
+    Console& console_;
+public:
+    constexpr static auto const ID = "open";
+
+    OpenCmd(Document& doc, Console& console) : doc_(doc), console_(console) {}
+
+    std::shared_ptr<Command> prepare() override
+    {
+        console_.print("> Enter file path:");
+        std::string path = console_.get_line();
+
+        return std::make_shared<FunctionCmd>([&doc = doc_, &console = console_, path = std::move(path)] {
+            try
+            {
+                load_document(doc, path);
+            }
+            catch (const std::exception& e)
+            {
+                console.print(std::string{"Error: "} + e.what());
+            }
+        });
+    }
+};
+
+class SaveCmd : public InteractiveCmd
+{
+    Document& doc_;
+    Console& console_;
+public:
+    constexpr static auto const ID = "save";
+
+    SaveCmd(Document& doc, Console& console) : doc_(doc), console_(console) {}
+
+    std::shared_ptr<Command> prepare() override
+    {
+        console_.print("> Enter file path:");
+        std::string path = console_.get_line();
+
+        return std::make_shared<FunctionCmd>([&doc = doc_, &console = console_, path = std::move(path)] {
+            try
+            {
+                save_document(doc, path);
+            }
+            catch (const std::exception& e)
+            {
+                console.print(std::string{"Error: "} + e.what());
+            }
+        });
+    }
+};
+
+class FindCmd : public InteractiveCmd
+{
+    Document& doc_;
+    Console& console_;
+public:
+    constexpr static auto const ID = "find";
+
+    FindCmd(Document& doc, Console& console) : doc_(doc), console_(console) {}
+
+    std::shared_ptr<Command> prepare() override
+    {
+        console_.print("> Enter text to find:");
+        std::string pattern = console_.get_line();
+
+        if (pattern.empty())
+            return std::make_shared<FunctionCmd>([] {});
+
+        return std::make_shared<FunctionCmd>([&doc = doc_, &console = console_, pattern = std::move(pattern)] {
+            console.print("Found " + std::to_string(TextSearch::find_all(doc, pattern).size()) + " matches");
+        });
+    }
+};
+
+class ReplaceCmd : public InteractiveCmd
+{
+    Document& doc_;
+    Console& console_;
+public:
+    constexpr static auto const ID = "replace";
+
+    ReplaceCmd(Document& doc, Console& console) : doc_(doc), console_(console) {}
+
+    std::shared_ptr<Command> prepare() override
+    {
+        console_.print("> Enter text to find:");
+        std::string pattern = console_.get_line();
+
+        if (pattern.empty())
+            return std::make_shared<FunctionCmd>([] {});
+
+        console_.print("> Enter replacement:");
+        std::string replacement = console_.get_line();
+
+        return std::make_shared<FunctionCmd>([&doc = doc_, &console = console_, pattern = std::move(pattern), replacement = std::move(replacement)] {
+            console.print("Replaced " + std::to_string(TextSearch::replace_all(doc, pattern, replacement)) + " matches");
+        });
+    }
+};
+
+// Records a step in the history when the decorated command changes the document
+class UndoableCmd : public Command
+{
+    std::shared_ptr<Command> cmd_;
+    History& history_;
+public:
+    UndoableCmd(std::shared_ptr<Command> cmd, History& history) : cmd_(std::move(cmd)), history_(history) {}
+
+    void execute() override
+    {
+        history_.record([this] { cmd_->execute(); });
+    }
+
+    // the prepared work of the decorated command is recorded as well
+    std::shared_ptr<Command> prepare() override
+    {
+        auto prepared = cmd_->prepare();
+
+        return prepared ? std::make_shared<UndoableCmd>(std::move(prepared), history_) : nullptr;
+    }
+};
+
+class UndoCmd : public Command
+{
+    History& history_;
+    Console& console_;
+public:
+    constexpr static auto const ID = "undo";
+
+    UndoCmd(History& history, Console& console) : history_(history), console_(console) {}
+
+    void execute() override
+    {
+        if (!history_.undo())
+            console_.print("Nothing to undo");
+    }
+};
+
+class RedoCmd : public Command
+{
+    History& history_;
+    Console& console_;
+public:
+    constexpr static auto const ID = "redo";
+
+    RedoCmd(History& history, Console& console) : history_(history), console_(console) {}
+
+    void execute() override
+    {
+        if (!history_.redo())
+            console_.print("Nothing to redo");
     }
 };
 
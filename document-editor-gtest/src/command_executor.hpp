@@ -0,0 +1,243 @@
+#ifndef COMMAND_EXECUTOR_HPP
+#define COMMAND_EXECUTOR_HPP
+
+#include "command.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+
+// Completion and cancellation of a submitted command - copies refer to the same command
+class CommandTicket
+{
+public:
+    enum class State
+    {
+        queued,
+        running,
+        done,
+        failed,
+        cancelled
+    };
+
+    CommandTicket()
+        : shared_{std::make_shared<Shared>()}
+    {
+    }
+
+    State state() const
+    {
+        std::lock_guard lk{shared_->mtx};
+
+        return shared_->state;
+    }
+
+    // done, failed or cancelled
+    bool finished() const
+    {
+        const State current = state();
+
+        return current != State::queued && current != State::running;
+    }
+
+    // only a queued command can be cancelled - returns false when it has already started
+    // or was cancelled before
+    bool cancel()
+    {
+        std::lock_guard lk{shared_->mtx};
+
+        if (shared_->state != State::queued)
+            return false;
+
+        shared_->state = State::cancelled;
+        shared_->finished.notify_all();
+
+        return true;
+    }
+
+    // waits until the command is done or cancelled - rethrows an exception thrown by the command
+    void wait() const
+    {
+        std::unique_lock lk{shared_->mtx};
+        shared_->finished.wait(lk, [this] { return shared_->state != State::queued && shared_->state != State::running; });
+
+        if (shared_->error)
+            std::rethrow_exception(shared_->error);
+    }
+
+private:
+    struct Shared
+    {
+        std::mutex mtx;
+        std::condition_variable finished;
+        State state = State::queued;
+        std::exception_ptr error;
+    };
+
+    std::shared_ptr<Shared> shared_;
+
+    // returns false when the command was cancelled
+    bool start()
+    {
+        std::lock_guard lk{shared_->mtx};
+
+        if (shared_->state == State::cancelled)
+            return false;
+
+        shared_->state = State::running;
+        return true;
+    }
+
+    void finish(std::exception_ptr error)
+    {
+        std::lock_guard lk{shared_->mtx};
+
+        shared_->state = error ? State::failed : State::done;
+        shared_->error = std::move(error);
+        shared_->finished.notify_all();
+    }
+
+    friend class InlineExecutor;
+    friend class WorkerExecutor;
+};
+
+class CommandExecutor
+{
+public:
+    virtual CommandTicket submit(std::shared_ptr<Command> cmd) = 0;
+
+    // waits until all submitted commands are finished
+    virtual void drain() = 0;
+
+    virtual ~CommandExecutor() = default;
+};
+
+// Executes commands immediately in the calling thread - exceptions are propagated to the caller
+class InlineExecutor : public CommandExecutor
+{
+public:
+    CommandTicket submit(std::shared_ptr<Command> cmd) override
+    {
+        CommandTicket ticket;
+        ticket.start();
+
+        try
+        {
+            cmd->execute();
+        }
+        catch (...)
+        {
+            ticket.finish(std::current_exception());
+            throw;
+        }
+
+        ticket.finish(nullptr);
+        return ticket;
+    }
+
+    void drain() override
+    {
+    }
+};
+
+// Executes commands one by one in a worker thread in the order of submission -
+// commands working on the same document never run concurrently or out of order.
+// Exceptions thrown by commands are stored in their tickets.
+// Commands still queued are executed before the executor is destroyed.
+class WorkerExecutor : public CommandExecutor
+{
+public:
+    WorkerExecutor()
+        : worker_{[this](std::stop_token stop) { run(stop); }}
+    {
+    }
+
+    WorkerExecutor(const WorkerExecutor&) = delete;
+    WorkerExecutor& operator=(const WorkerExecutor&) = delete;
+
+    CommandTicket submit(std::shared_ptr<Command> cmd) override
+    {
+        CommandTicket ticket;
+
+        {
+            std::lock_guard lk{mtx_};
+            queue_.emplace_back(std::move(cmd), ticket);
+        }
+
+        work_available_.notify_one();
+
+        return ticket;
+    }
+
+    void drain() override
+    {
+        std::unique_lock lk{mtx_};
+        idle_.wait(lk, [this] { return queue_.empty() && !busy_; });
+    }
+
+    // returns the number of cancelled commands - the running command is not interrupted
+    size_t cancel_pending()
+    {
+        std::lock_guard lk{mtx_};
+
+        size_t cancelled = 0;
+        for (auto& [cmd, ticket] : queue_)
+            cancelled += ticket.cancel();
+
+        queue_.clear();
+        idle_.notify_all();
+
+        return cancelled;
+    }
+
+private:
+    std::mutex mtx_;
+    std::condition_variable_any work_available_;
+    std::condition_variable idle_;
+    std::deque<std::pair<std::shared_ptr<Command>, CommandTicket>> queue_;
+    bool busy_ = false;
+    std::jthread worker_; // the last member - joined before the queue is destroyed
+
+    void run(std::stop_token stop)
+    {
+        while (true)
+        {
+            std::unique_lock lk{mtx_};
+
+            if (!work_available_.wait(lk, stop, [this] { return !queue_.empty(); }))
+                return;
+
+            auto [cmd, ticket] = std::move(queue_.front());
+            queue_.pop_front();
+            busy_ = true;
+
+            lk.unlock();
+
+            if (ticket.start())
+            {
+                try
+                {
+                    cmd->execute();
+                    ticket.finish(nullptr);
+                }
+                catch (...)
+                {
+                    ticket.finish(std::current_exception());
+                }
+            }
+
+            lk.lock();
+            busy_ = false;
+
+            if (queue_.empty())
+                idle_.notify_all();
+        }
+    }
+};
+
+#endif // COMMAND_EXECUTOR_HPP
@@ -2,18 +2,37 @@
 #define CONSOLE_HPP
 
 #include <iostream>
+#include <mutex>
+#include <span>
 #include <string>
+#include <string_view>
 
 class Console
 {
 public:
     virtual std::string get_line() = 0;
     virtual void print(const std::string& line) = 0;
+
+    // prints fragments as one line - consoles that can write them one by one
+    // should override it to avoid building the line
+    virtual void print_fragments(std::span<const std::string_view> fragments)
+    {
+        std::string line;
+
+        for (auto fragment : fragments)
+            line.append(fragment);
+
+        print(line);
+    }
+
     virtual ~Console() = default;
 };
 
+// Lines printed from different threads are not interleaved
 class Terminal : public Console
 {
+    std::mutex output_mtx_;
+
 public:
     std::string get_line() override
     {
@@ -25,8 +44,20 @@ public:
 
     void print(const std::string& line) override
     {
+        std::lock_guard lk{output_mtx_};
+
         std::cout << line << std::endl;
     }
+
+    void print_fragments(std::span<const std::string_view> fragments) override
+    {
+        std::lock_guard lk{output_mtx_};
+
+        for (auto fragment : fragments)
+            std::cout << fragment;
+
+        std::cout << std::endl;
+    }
 };
 
 #endif // CONSOLE_HPP
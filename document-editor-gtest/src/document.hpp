@@ -1,22 +1,53 @@
 #ifndef DOCUMENT_HPP
 #define DOCUMENT_HPP
 
+#include "case_conversion.hpp"
+#include "piece_table.hpp"
+
 #include <sstream>
 #include <algorithm>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
 #include <cereal/archives/binary.hpp>
 #include <cereal/types/string.hpp>
 
 
+// Text is kept in a piece table - edits in the middle of a large document
+// do not move the text
 class Document
 {
-    std::string text_;
+    PieceTable text_;
+    size_t revision_ = 0;      // changed by every change of the text
+    size_t last_revision_ = 0;
 
 public:
     class Memento
     {
+    public:
+        size_t revision() const
+        {
+            return revision_;
+        }
+
+        // memory the memento keeps alive that the other one does not share -
+        // the snapshot or the nodes and the text only its revision refers to
+        size_t size_in_bytes(const Memento& other) const
+        {
+            if (!text_)
+                return snapshot_.size();
+
+            return text_->bytes_not_shared_with(other.text_ ? *other.text_ : PieceTable{});
+        }
+
     private:
         std::string snapshot_;
+        std::optional<PieceTable> text_;
+        size_t revision_ = 0;
 
         friend class Document;
     };
@@ -29,9 +60,27 @@ public:
     {
     }
 
+    // the same revision means the same text - restoring a memento restores its revision
+    size_t revision() const
+    {
+        return revision_;
+    }
+
     std::string text() const
     {
-        return text_;
+        return text_.text();
+    }
+
+    // consecutive fragments of the text without copying it - valid until the document is changed
+    PieceTable::Chunks chunks() const
+    {
+        return text_.chunks();
+    }
+
+    // whole text without copying it - only when it is stored contiguously
+    std::optional<std::string_view> text_view() const
+    {
+        return text_.contiguous_view();
     }
 
     size_t length() const
@@ -39,35 +88,126 @@ public:
         return text_.size();
     }
 
+    // memory of the text and of the pieces it is made of (estimate)
+    size_t size_in_bytes() const
+    {
+        return text_.size() + text_.pieces_count() * PieceTable::bytes_per_piece;
+    }
+
+    // lines are separated by '\n' - the text without any line break is a single line
+    size_t line_count() const
+    {
+        return text_.line_count();
+    }
+
+    TextPosition position_of(size_t offset) const
+    {
+        const size_t line = text_.line_of(offset);
+
+        return TextPosition{line, offset - text_.line_start(line)};
+    }
+
+    size_t offset_of(TextPosition position) const
+    {
+        const TextRange line = text_.line_range(position.line);
+
+        if (position.column > line.length)
+            throw std::out_of_range("column is out of the line");
+
+        return line.pos + position.column;
+    }
+
+    // text of the line without its line break
+    std::string line(size_t line) const
+    {
+        const TextRange range = text_.line_range(line);
+
+        return text_.substr(range.pos, range.length);
+    }
+
     void add_text(const std::string& txt)
     {
-        text_ += txt;
+        insert(text_.size(), txt);
+    }
+
+    void insert(size_t pos, std::string_view text)
+    {
+        text_.insert(pos, text);
+
+        if (!text.empty())
+            new_revision();
+    }
+
+    void erase(size_t start_pos, size_t count)
+    {
+        const size_t length = text_.size();
+        text_.erase(start_pos, count);
+
+        if (text_.size() != length)
+            new_revision();
     }
 
     void to_upper()
     {
-        std::transform(text_.begin(), text_.end(), text_.begin(), [](auto c) { return std::toupper(c); });        
+        if (text_.empty())
+            return;
+
+        std::string text = text_.text();
+        CaseConversion::to_upper(text);
+        text_ = PieceTable{std::move(text)};
+        new_revision();
     }
 
     void to_lower()
     {
-        std::transform(text_.begin(), text_.end(), text_.begin(), [](auto c) { return std::tolower(c); });
+        if (text_.empty())
+            return;
+
+        std::string text = text_.text();
+        CaseConversion::to_lower(text);
+        text_ = PieceTable{std::move(text)};
+        new_revision();
     }
 
     void clear()
     {
+        if (text_.empty())
+            return;
+
         text_.clear();
+        new_revision();
     }
 
+    // replaces the whole text - e.g. with a piece table over a mapped file
+    void reset(PieceTable text)
+    {
+        text_ = std::move(text);
+        new_revision();
+    }
+
+    // full snapshot of the text - independent of the document
     template <typename TSerializer = cereal::BinaryOutputArchive>
     Memento create_memento() const
     {
         std::stringstream stream;
         TSerializer oarchive(stream);
-        oarchive(text_);
+        oarchive(text_.text());
 
         Memento memento;
         memento.snapshot_ = stream.str();
+        memento.revision_ = revision_;
+
+        return memento;
+    }
+
+    // O(1) memento keeping a copy of the current piece table - it records no delta, the nodes
+    // and buffers are shared with the document, so a stack of shared mementos grows with
+    // the volume of edits, not with the size of the document. Restoring it only swaps the roots.
+    Memento create_shared_memento() const
+    {
+        Memento memento;
+        memento.text_ = text_;
+        memento.revision_ = revision_;
 
         return memento;
     }
@@ -75,14 +215,60 @@ public:
     template <typename TDeserializer = cereal::BinaryInputArchive>
     void set_memento(Memento& memento)
     {
+        if (memento.text_)
+        {
+            text_ = *memento.text_;
+            revision_ = memento.revision_;
+            return;
+        }
+
         std::stringstream stream{memento.snapshot_};
         TDeserializer iarchive(stream);
-        iarchive(text_);
+
+        std::string text;
+        iarchive(text);
+        text_ = PieceTable{std::move(text)};
+        revision_ = memento.revision_;
     }
 
     void replace(size_t start_pos, size_t count, const std::string& text)
     {
+        const bool removes = count > 0 && start_pos < text_.size();
         text_.replace(start_pos, count, text);
+
+        if (removes || !text.empty())
+            new_revision();
+    }
+
+    // replaces all ranges (sorted and not overlapping) with the same text as a single change -
+    // a new piece table is built in one pass, the text itself is not moved
+    void replace_all(std::span<const TextRange> ranges, std::string_view replacement)
+    {
+        if (ranges.empty())
+            return;
+
+        text_.replace_all(ranges, replacement);
+        new_revision();
+    }
+
+    // drops text that neither the document nor the mementos refer to from the buffers they share
+    void compact(std::span<Memento* const> mementos)
+    {
+        std::vector<PieceTable*> tables{&text_};
+
+        for (Memento* memento : mementos)
+        {
+            if (memento->text_)
+                tables.push_back(&*memento->text_);
+        }
+
+        PieceTable::compact(tables);
+    }
+
+private:
+    void new_revision()
+    {
+        revision_ = ++last_revision_;
     }
 };
 
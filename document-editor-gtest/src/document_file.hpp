@@ -0,0 +1,204 @@
+#ifndef DOCUMENT_FILE_HPP
+#define DOCUMENT_FILE_HPP
+
+#include "document.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+// Read-only view of a whole file - mapped into memory where mmap is available
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::filesystem::path& path)
+    {
+#if __has_include(<sys/mman.h>)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            throw std::runtime_error("cannot open file: " + path.string());
+
+        struct stat file_stat{};
+        if (::fstat(fd, &file_stat) == -1)
+        {
+            ::close(fd);
+            throw std::runtime_error("cannot read file: " + path.string());
+        }
+
+        size_ = static_cast<size_t>(file_stat.st_size);
+
+        if (size_ > 0)
+        {
+            data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (data_ == MAP_FAILED)
+            {
+                ::close(fd);
+                throw std::runtime_error("cannot map file: " + path.string());
+            }
+        }
+
+        ::close(fd);
+#else
+        std::ifstream in{path, std::ios::binary};
+        if (!in)
+            throw std::runtime_error("cannot open file: " + path.string());
+
+        content_.assign(std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{});
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+#if __has_include(<sys/mman.h>)
+        if (size_ > 0)
+            ::munmap(data_, size_);
+#endif
+    }
+
+    std::string_view view() const
+    {
+#if __has_include(<sys/mman.h>)
+        return size_ > 0 ? std::string_view{static_cast<const char*>(data_), size_} : std::string_view{};
+#else
+        return content_;
+#endif
+    }
+
+private:
+#if __has_include(<sys/mman.h>)
+    void* data_ = nullptr;
+    size_t size_ = 0;
+#else
+    std::string content_;
+#endif
+};
+
+// The file becomes the original buffer of the document's piece table - it is not read
+// until its pages are used (line breaks are counted per block when lines are looked up)
+// and edits are layered on top of it.
+// The mapping lives as long as the document or any of its mementos refers to it.
+inline void load_document(Document& doc, const std::filesystem::path& path)
+{
+    auto file = std::make_shared<const MappedFile>(path);
+    const std::string_view text = file->view();
+
+    doc.reset(PieceTable{text, std::move(file)});
+}
+
+namespace DocumentFile
+{
+#if __has_include(<sys/mman.h>)
+    inline void write_all(int fd, std::vector<iovec>& buffers)
+    {
+        iovec* first = buffers.data();
+        iovec* last = buffers.data() + buffers.size();
+
+        while (first != last)
+        {
+            ssize_t written = ::writev(fd, first, static_cast<int>(last - first));
+
+            if (written == -1)
+            {
+                if (errno == EINTR)
+                    continue;
+
+                throw std::runtime_error("cannot write file");
+            }
+
+            for (; first != last && static_cast<size_t>(written) >= first->iov_len; ++first)
+                written -= first->iov_len;
+
+            if (first != last)
+            {
+                first->iov_base = static_cast<char*>(first->iov_base) + written;
+                first->iov_len -= written;
+            }
+        }
+
+        buffers.clear();
+    }
+#endif
+} // namespace DocumentFile
+
+// Pieces of the document are written straight from their buffers (the mapped original file
+// included) to a temporary file that replaces the target - a document mapped from the target
+// stays valid.
+inline void save_document(const Document& doc, const std::filesystem::path& path)
+{
+    std::filesystem::path temp_path = path;
+    temp_path += ".tmp";
+
+#if __has_include(<sys/mman.h>)
+    int fd = ::open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1)
+        throw std::runtime_error("cannot create file: " + temp_path.string());
+
+    try
+    {
+        constexpr size_t max_buffers = IOV_MAX < 1024 ? IOV_MAX : 1024;
+
+        std::vector<iovec> buffers;
+        buffers.reserve(max_buffers);
+
+        for (auto chunk : doc.chunks())
+        {
+            buffers.push_back(iovec{const_cast<char*>(chunk.data()), chunk.size()});
+
+            if (buffers.size() == max_buffers)
+                DocumentFile::write_all(fd, buffers);
+        }
+
+        DocumentFile::write_all(fd, buffers);
+
+        if (::fsync(fd) == -1)
+            throw std::runtime_error("cannot write file");
+    }
+    catch (...)
+    {
+        ::close(fd);
+        ::unlink(temp_path.c_str());
+        throw;
+    }
+
+    if (::close(fd) == -1)
+    {
+        ::unlink(temp_path.c_str());
+        throw std::runtime_error("cannot write file: " + temp_path.string());
+    }
+#else
+    {
+        std::ofstream out{temp_path, std::ios::binary | std::ios::trunc};
+        if (!out)
+            throw std::runtime_error("cannot create file: " + temp_path.string());
+
+        for (auto chunk : doc.chunks())
+            out.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+
+        if (!out.flush())
+            throw std::runtime_error("cannot write file: " + temp_path.string());
+    }
+#endif
+
+    std::filesystem::rename(temp_path, path);
+}
+
+#endif // DOCUMENT_FILE_HPP
@@ -0,0 +1,153 @@
+#ifndef HISTORY_HPP
+#define HISTORY_HPP
+
+#include "document.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <utility>
+#include <vector>
+
+// Undo/redo stacks of shared mementos of a document.
+// Mementos share nodes and buffers of the piece table with the document, so every step is charged
+// only for the memory it does not share with its neighbour closer to the document - the nodes
+// and the text only its revision refers to. Undo/redo only swap the roots of the piece table.
+// When the steps exceed the memory budget the oldest undo steps are forgotten - their nodes are
+// freed at once and their text when the buffers are compacted. Compaction copies the whole text,
+// so it waits until the forgotten steps add up to a quarter of the budget and to the size of the document.
+class History
+{
+public:
+    constexpr static size_t default_memory_budget = 64 * 1024 * 1024;
+
+    explicit History(Document& doc, size_t memory_budget = default_memory_budget)
+        : doc_{doc}
+        , memory_budget_{memory_budget}
+    {
+    }
+
+    // changes the document with the function - a step is recorded only when the document is changed
+    template <typename TChange>
+    void record(TChange&& change)
+    {
+        Document::Memento before = doc_.create_shared_memento();
+        std::forward<TChange>(change)();
+
+        if (doc_.revision() == before.revision())
+            return;
+
+        for (const auto& step : redo_steps_)
+            forget(step);
+
+        redo_steps_.clear();
+
+        push(undo_steps_, std::move(before));
+        evict_oldest();
+    }
+
+    bool undo()
+    {
+        return move_step(undo_steps_, redo_steps_);
+    }
+
+    bool redo()
+    {
+        if (!move_step(redo_steps_, undo_steps_))
+            return false;
+
+        evict_oldest();
+        return true;
+    }
+
+    size_t undo_count() const
+    {
+        return undo_steps_.size();
+    }
+
+    size_t redo_count() const
+    {
+        return redo_steps_.size();
+    }
+
+    size_t memory_usage() const
+    {
+        return memory_usage_;
+    }
+
+private:
+    struct Step
+    {
+        Document::Memento memento;
+        size_t size_in_bytes; // not shared with the next step closer to the document
+    };
+
+    Document& doc_;
+    size_t memory_budget_;
+    size_t memory_usage_ = 0;
+    size_t forgotten_bytes_ = 0; // since the last compaction
+    std::deque<Step> undo_steps_;
+    std::vector<Step> redo_steps_;
+
+    // the memento is the neighbour of the current state of the document
+    template <typename TSteps>
+    void push(TSteps& steps, Document::Memento memento)
+    {
+        const size_t size = memento.size_in_bytes(doc_.create_shared_memento());
+
+        memory_usage_ += size;
+        steps.push_back(Step{std::move(memento), size});
+    }
+
+    template <typename TFrom, typename TTo>
+    bool move_step(TFrom& from, TTo& to)
+    {
+        if (from.empty())
+            return false;
+
+        Document::Memento current = doc_.create_shared_memento();
+
+        memory_usage_ -= from.back().size_in_bytes;
+        doc_.set_memento(from.back().memento);
+        from.pop_back();
+
+        push(to, std::move(current));
+
+        return true;
+    }
+
+    void forget(const Step& step)
+    {
+        memory_usage_ -= step.size_in_bytes;
+        forgotten_bytes_ += step.size_in_bytes;
+    }
+
+    // the last step is always kept - even if it is larger than the budget
+    void evict_oldest()
+    {
+        while (memory_usage_ > memory_budget_ && undo_steps_.size() > 1)
+        {
+            forget(undo_steps_.front());
+            undo_steps_.pop_front();
+        }
+
+        if (forgotten_bytes_ > std::max(memory_budget_ / 4, doc_.size_in_bytes()))
+            compact();
+    }
+
+    void compact()
+    {
+        std::vector<Document::Memento*> mementos;
+        mementos.reserve(undo_steps_.size() + redo_steps_.size());
+
+        for (auto& step : undo_steps_)
+            mementos.push_back(&step.memento);
+
+        for (auto& step : redo_steps_)
+            mementos.push_back(&step.memento);
+
+        doc_.compact(mementos);
+        forgotten_bytes_ = 0;
+    }
+};
+
+#endif // HISTORY_HPP
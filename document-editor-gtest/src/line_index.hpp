@@ -0,0 +1,137 @@
+#ifndef LINE_INDEX_HPP
+#define LINE_INDEX_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LINE_INDEX_SSE2
+#endif
+
+// Prefix sums of numbers of line breaks in 64 KB blocks of a buffer - extended when a block is first needed,
+// so only the part of the buffer lines are looked up in is read (a mapped file is not scanned on open).
+// Lookups binary search the sums and scan at most one block.
+// The buffer may grow at the end - only complete blocks are summed, so the sums never change.
+// Copies of a piece table share the index, so extending it is guarded by a mutex.
+class LineIndex
+{
+public:
+    constexpr static size_t block_size = 64 * 1024;
+
+    // line breaks in text[start, start + length)
+    size_t count(std::string_view text, size_t start, size_t length) const
+    {
+        if (length <= block_size / 2)
+            return count_in(text.substr(start, length));
+
+        std::lock_guard lk{mtx_};
+
+        return breaks_before(text, start + length) - breaks_before(text, start);
+    }
+
+    // position of the n-th (counted from 0) line break at start or later - it must exist in text
+    size_t find_nth(std::string_view text, size_t start, size_t n) const
+    {
+        std::lock_guard lk{mtx_};
+
+        const size_t target = breaks_before(text, start) + n; // line breaks before the one searched for in text
+        const size_t complete_blocks = text.size() / block_size;
+
+        while (prefix_sums_.back() <= target && prefix_sums_.size() <= complete_blocks)
+            add_block(text);
+
+        const size_t block = static_cast<size_t>(std::upper_bound(prefix_sums_.begin(), prefix_sums_.end(), target) - prefix_sums_.begin()) - 1;
+        const size_t block_start = block * block_size;
+
+        return block_start + find_nth_in(text.substr(block_start, block_size), target - prefix_sums_[block]);
+    }
+
+private:
+    mutable std::mutex mtx_;
+    mutable std::vector<size_t> prefix_sums_{0}; // [b] - line breaks in blocks before the block b
+
+    // scans from the nearer end of the block of pos
+    size_t breaks_before(std::string_view text, size_t pos) const
+    {
+        const size_t block = pos / block_size;
+        const size_t block_start = block * block_size;
+        const bool complete = block_start + block_size <= text.size();
+        const bool in_second_half = pos - block_start > block_size / 2;
+
+        while (prefix_sums_.size() <= block + (complete && in_second_half))
+            add_block(text);
+
+        if (complete && in_second_half)
+            return prefix_sums_[block + 1] - count_in(text.substr(pos, block_start + block_size - pos));
+
+        return prefix_sums_[block] + count_in(text.substr(block_start, pos - block_start));
+    }
+
+    // the next block must be complete
+    void add_block(std::string_view text) const
+    {
+        const size_t block = prefix_sums_.size() - 1;
+
+        prefix_sums_.push_back(prefix_sums_.back() + count_in(text.substr(block * block_size, block_size)));
+    }
+
+    // 16 bytes are compared at a time
+    static size_t count_in(std::string_view text)
+    {
+        size_t result = 0;
+        size_t pos = 0;
+
+#ifdef LINE_INDEX_SSE2
+        const __m128i line_break = _mm_set1_epi8('\n');
+
+        for (; pos + 16 <= text.size(); pos += 16)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + pos));
+            result += std::popcount(static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, line_break))));
+        }
+#endif
+        for (; pos < text.size(); ++pos)
+            result += text[pos] == '\n';
+
+        return result;
+    }
+
+    static size_t find_nth_in(std::string_view text, size_t n)
+    {
+        size_t pos = 0;
+
+#ifdef LINE_INDEX_SSE2
+        const __m128i line_break = _mm_set1_epi8('\n');
+
+        for (; pos + 16 <= text.size(); pos += 16)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text.data() + pos));
+            auto found = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, line_break)));
+            const auto found_count = static_cast<size_t>(std::popcount(found));
+
+            if (n < found_count)
+            {
+                for (; n > 0; --n)
+                    found &= found - 1;
+
+                return pos + std::countr_zero(found);
+            }
+
+            n -= found_count;
+        }
+#endif
+        for (;; ++pos)
+        {
+            if (text[pos] == '\n' && n-- == 0)
+                return pos;
+        }
+    }
+};
+
+#endif // LINE_INDEX_HPP
@@ -0,0 +1,925 @@
+#ifndef PIECE_TABLE_HPP
+#define PIECE_TABLE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "line_index.hpp"
+
+// Part of a text - e.g. a match of a search
+struct TextRange
+{
+    size_t pos;
+    size_t length;
+
+    bool operator==(const TextRange&) const = default;
+};
+
+// Line and column of a character - both counted from 0
+struct TextPosition
+{
+    size_t line;
+    size_t column;
+
+    bool operator==(const TextPosition&) const = default;
+};
+
+// Text stored as a sequence of pieces - slices of the original text or of an append-only buffer
+// of added text. Pieces are kept in a treap ordered by position, with the length of every subtree
+// in its root, so insert, erase and replace are O(log n) in the number of pieces and never move
+// the text itself.
+//
+// Every node caches the number of line breaks in its subtree - counted when lines are first looked up
+// (with the line index of the buffers), so after that lines are found in O(log n) as well.
+// The caches may be filled by concurrent readers of copies of the table.
+//
+// Nodes are immutable and shared (changes copy only the path from the root), so copying
+// a piece table is O(1) - copies share the nodes and both text buffers.
+class PieceTable
+{
+public:
+    PieceTable()
+        : original_lines_{std::make_shared<LineIndex>()}
+        , added_{std::make_shared<AddedBuffer>()}
+    {
+    }
+
+    explicit PieceTable(std::string text)
+        : PieceTable()
+    {
+        auto owner = std::make_shared<const std::string>(std::move(text));
+        set_original(*owner, owner);
+    }
+
+    // original text owned by another object (e.g. a mapped file) - kept alive by the owner
+    PieceTable(std::string_view original, std::shared_ptr<const void> owner)
+        : PieceTable()
+    {
+        set_original(original, std::move(owner));
+    }
+
+    size_t size() const
+    {
+        return length(root_);
+    }
+
+    bool empty() const
+    {
+        return root_ == nullptr;
+    }
+
+    size_t pieces_count() const
+    {
+        return count(root_);
+    }
+
+    void insert(size_t pos, std::string_view text)
+    {
+        check_position(pos);
+
+        if (text.empty())
+            return;
+
+        auto [left, right] = split(root_, pos);
+
+        const size_t start = append_added(text);
+
+        if (!extend_last_piece(left, start, text.size()))
+            left = merge(left, make_node(nullptr, Piece{Source::added, start, text.size()}, next_priority(), nullptr));
+
+        root_ = merge(left, right);
+    }
+
+    void erase(size_t pos, size_t count)
+    {
+        check_position(pos);
+
+        auto [left, rest] = split(root_, pos);
+        auto [erased, right] = split(rest, count);
+
+        root_ = merge(left, right);
+    }
+
+    void replace(size_t pos, size_t count, std::string_view text)
+    {
+        erase(pos, count);
+        insert(pos, text);
+    }
+
+    constexpr static size_t bytes_per_piece = 128; // memory of a node of the tree (estimate)
+
+    // replaces all ranges (sorted and not overlapping) in a single pass over the pieces -
+    // the replacement is added once and shared by all pieces that replace the ranges;
+    // when the pieces would take more memory than the text, the text is copied into a new buffer
+    void replace_all(std::span<const TextRange> ranges, std::string_view replacement)
+    {
+        check_ranges(ranges);
+
+        if (ranges.empty())
+            return;
+
+        const Piece replacement_piece{Source::added, append_added(replacement), replacement.size()};
+
+        std::vector<Piece> pieces;
+        pieces.reserve(2 * ranges.size() + 1);
+        size_t new_size = 0;
+        auto append = [&pieces, &new_size](const Piece& piece) {
+            if (piece.length > 0)
+            {
+                pieces.push_back(piece);
+                new_size += piece.length;
+            }
+        };
+
+        auto range = ranges.begin();
+        size_t offset = 0;      // of the current piece in the text
+        size_t replaced_to = 0; // text before is covered by replaced ranges
+
+        auto copy_piece = [&](const Piece& piece) {
+            const size_t end = offset + piece.length;
+
+            for (size_t pos = std::max(offset, replaced_to); pos < end;)
+            {
+                if (range != ranges.end() && range->pos < end)
+                {
+                    append(Piece{piece.source, piece.start + (pos - offset), range->pos - pos});
+                    append(replacement_piece);
+
+                    pos = replaced_to = range->pos + range->length;
+                    ++range;
+                }
+                else
+                {
+                    append(Piece{piece.source, piece.start + (pos - offset), end - pos});
+                    pos = end;
+                }
+            }
+
+            offset = end;
+        };
+        for_each_piece(root_, copy_piece);
+
+        // empty ranges at the end of the text
+        for (; range != ranges.end(); ++range)
+            append(replacement_piece);
+
+        if (pieces.size() * bytes_per_piece > new_size)
+            flatten(pieces, new_size);
+        else
+            root_ = build(pieces);
+    }
+
+    void clear()
+    {
+        *this = PieceTable{};
+    }
+
+    // memory this table keeps alive that the other one does not share - its own nodes and the parts
+    // of the buffers only its own pieces cover. Both trees are walked together from the most recently
+    // created node down - a node is created after its children, so it is reached from all its parents
+    // in both trees before it is taken. Subtrees shared by the tables are skipped and the cost is
+    // proportional to the difference between them. (Priorities can not order the walk - the parts of
+    // a split piece get the same one.)
+    size_t bytes_not_shared_with(const PieceTable& other) const
+    {
+        constexpr unsigned mine = 1;
+        constexpr unsigned theirs = 2;
+
+        std::unordered_map<const Node*, unsigned> reached_from;
+        auto created_earlier = [](const Node* a, const Node* b) { return a->serial < b->serial; };
+        std::priority_queue<const Node*, std::vector<const Node*>, decltype(created_earlier)> queue{created_earlier};
+
+        auto reach = [&](const NodePtr& node, unsigned side) {
+            if (!node)
+                return;
+
+            unsigned& sides = reached_from[node.get()];
+            if (sides == 0)
+                queue.push(node.get());
+            sides |= side;
+        };
+
+        reach(root_, mine);
+        reach(other.root_, theirs);
+
+        size_t own_nodes = 0;
+        std::vector<BufferRange> own_ranges;
+        std::vector<BufferRange> other_ranges;
+
+        while (!queue.empty())
+        {
+            const Node* node = queue.top();
+            queue.pop();
+
+            const unsigned sides = reached_from[node];
+
+            if (sides == (mine | theirs))
+                continue;
+
+            if (sides == mine)
+            {
+                ++own_nodes;
+                own_ranges.push_back(range_of(node->piece));
+            }
+            else
+                other_ranges.push_back(other.range_of(node->piece));
+
+            reach(node->left, sides);
+            reach(node->right, sides);
+        }
+
+        return own_nodes * bytes_per_piece + uncovered_bytes(std::move(own_ranges), std::move(other_ranges));
+    }
+
+    // drops text that none of the tables refers to from their added buffers - tables sharing a buffer
+    // get a new one with only the text covered by their pieces. Nodes are copied once, so the tables
+    // still share them (cached line counts are kept).
+    static void compact(std::span<PieceTable* const> tables)
+    {
+        std::vector<std::shared_ptr<AddedBuffer>> buffers;
+
+        for (PieceTable* table : tables)
+        {
+            if (std::find(buffers.begin(), buffers.end(), table->added_) == buffers.end())
+                buffers.push_back(table->added_);
+        }
+
+        for (const auto& buffer : buffers)
+        {
+            std::vector<PieceTable*> sharing;
+            std::copy_if(tables.begin(), tables.end(), std::back_inserter(sharing), [&](PieceTable* table) { return table->added_ == buffer; });
+
+            compact_buffer(*buffer, sharing);
+        }
+    }
+
+    std::string text() const
+    {
+        std::string result;
+        result.reserve(size());
+
+        for_each_chunk([&result](std::string_view chunk) { result.append(chunk); });
+
+        return result;
+    }
+
+    std::string substr(size_t pos, size_t count) const
+    {
+        check_position(pos);
+
+        auto [left, rest] = split(root_, pos);
+        auto [middle, right] = split(rest, count);
+
+        std::string result;
+        result.reserve(length(middle));
+
+        auto append = [&result](std::string_view chunk) { result.append(chunk); };
+        for_each_chunk(middle, append);
+
+        return result;
+    }
+
+    // calls f with consecutive fragments of the text - views are valid until the text is changed
+    template <typename F>
+    void for_each_chunk(F&& f) const
+    {
+        for_each_chunk(root_, f);
+    }
+
+    size_t line_count() const
+    {
+        return line_breaks(root_.get()) + 1;
+    }
+
+    // number of the line containing pos
+    size_t line_of(size_t pos) const
+    {
+        check_position(pos);
+
+        size_t line = 0;
+
+        for (const Node* node = root_.get(); node;)
+        {
+            const size_t left_length = length(node->left);
+
+            if (pos < left_length)
+            {
+                node = node->left.get();
+                continue;
+            }
+
+            line += line_breaks(node->left.get());
+            pos -= left_length;
+
+            if (pos < node->piece.length)
+                return line + lines_of(node->piece.source).count(buffer_of(node->piece.source), node->piece.start, pos);
+
+            line += piece_line_breaks(node);
+            pos -= node->piece.length;
+            node = node->right.get();
+        }
+
+        return line;
+    }
+
+    // offset of the first character of the line
+    size_t line_start(size_t line) const
+    {
+        if (line >= line_count())
+            throw std::out_of_range("line is out of the text");
+
+        size_t offset = 0;
+        size_t breaks_before = line; // the line starts after this many line breaks
+
+        for (const Node* node = root_.get(); breaks_before > 0;)
+        {
+            const size_t left_breaks = line_breaks(node->left.get());
+
+            if (breaks_before <= left_breaks)
+            {
+                node = node->left.get();
+                continue;
+            }
+
+            breaks_before -= left_breaks;
+            offset += length(node->left);
+
+            const size_t piece_breaks = piece_line_breaks(node);
+
+            if (breaks_before <= piece_breaks)
+            {
+                const Source source = node->piece.source;
+                const size_t line_break = lines_of(source).find_nth(buffer_of(source), node->piece.start, breaks_before - 1);
+
+                return offset + (line_break - node->piece.start) + 1;
+            }
+
+            breaks_before -= piece_breaks;
+            offset += node->piece.length;
+            node = node->right.get();
+        }
+
+        return offset;
+    }
+
+    // text of the line without its line break
+    TextRange line_range(size_t line) const
+    {
+        const size_t start = line_start(line);
+        const size_t end = line + 1 < line_count() ? line_start(line + 1) - 1 : size();
+
+        return TextRange{start, end - start};
+    }
+
+private:
+    enum class Source : std::uint8_t
+    {
+        original,
+        added
+    };
+
+    struct Piece
+    {
+        Source source;
+        size_t start;
+        size_t length;
+    };
+
+    struct AddedBuffer
+    {
+        std::string text;
+        LineIndex lines;
+    };
+
+    // part of one of the buffers
+    struct BufferRange
+    {
+        const void* buffer;
+        size_t start;
+        size_t end;
+    };
+
+    struct Node;
+    using NodePtr = std::shared_ptr<const Node>;
+
+    struct Node
+    {
+        Piece piece;
+        std::uint32_t priority;
+        std::uint64_t serial; // order of creation
+        NodePtr left;
+        NodePtr right;
+        size_t length; // of the whole subtree
+        size_t pieces; // of the whole subtree
+        // of the whole subtree - counted when first needed; nodes are shared by copies of the table
+        // that may be read concurrently, and all of them store the same number
+        mutable std::atomic<size_t> line_breaks;
+    };
+
+    constexpr static size_t unknown_line_breaks = static_cast<size_t>(-1);
+
+public:
+    // iterates over consecutive fragments of the text in order - in-order walk of the tree
+    class ChunkIterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = std::string_view;
+
+        ChunkIterator() = default;
+
+        std::string_view operator*() const
+        {
+            return table_->view(path_.back()->piece);
+        }
+
+        ChunkIterator& operator++()
+        {
+            const Node* node = path_.back();
+            path_.pop_back();
+            push_left_spine(node->right.get());
+
+            return *this;
+        }
+
+        ChunkIterator operator++(int)
+        {
+            ChunkIterator it = *this;
+            ++(*this);
+
+            return it;
+        }
+
+        bool operator==(const ChunkIterator& other) const
+        {
+            if (path_.empty() || other.path_.empty())
+                return path_.empty() && other.path_.empty();
+
+            return path_.back() == other.path_.back();
+        }
+
+    private:
+        const PieceTable* table_ = nullptr;
+        std::vector<const Node*> path_; // nodes with chunks still to visit - current one at the back
+
+        explicit ChunkIterator(const PieceTable& table)
+            : table_{&table}
+        {
+            push_left_spine(table.root_.get());
+        }
+
+        void push_left_spine(const Node* node)
+        {
+            for (; node; node = node->left.get())
+                path_.push_back(node);
+        }
+
+        friend class PieceTable;
+    };
+
+    struct Chunks
+    {
+        ChunkIterator first;
+
+        ChunkIterator begin() const
+        {
+            return first;
+        }
+
+        ChunkIterator end() const
+        {
+            return ChunkIterator{};
+        }
+    };
+
+    // views are valid until the text is changed
+    Chunks chunks() const
+    {
+        return Chunks{ChunkIterator{*this}};
+    }
+
+    // whole text as a single view - only when it is stored in one piece
+    std::optional<std::string_view> contiguous_view() const
+    {
+        if (!root_)
+            return std::string_view{};
+
+        if (root_->left || root_->right)
+            return std::nullopt;
+
+        return view(root_->piece);
+    }
+
+private:
+    std::shared_ptr<const void> original_owner_;
+    std::string_view original_;
+    std::shared_ptr<LineIndex> original_lines_;
+    std::shared_ptr<AddedBuffer> added_;
+    NodePtr root_;
+    std::uint32_t random_state_ = 2463534242u;
+
+    void set_original(std::string_view original, std::shared_ptr<const void> owner)
+    {
+        original_owner_ = std::move(owner);
+        original_ = original;
+
+        if (!original_.empty())
+            root_ = make_node(nullptr, Piece{Source::original, 0, original_.size()}, next_priority(), nullptr);
+    }
+
+    // returns the position of the text in the added buffer
+    size_t append_added(std::string_view text)
+    {
+        const size_t start = added_->text.size();
+
+        added_->text.append(text);
+
+        return start;
+    }
+
+    std::string_view buffer_of(Source source) const
+    {
+        return source == Source::original ? original_ : std::string_view{added_->text};
+    }
+
+    const LineIndex& lines_of(Source source) const
+    {
+        return source == Source::original ? *original_lines_ : added_->lines;
+    }
+
+    size_t line_breaks(const Node* node) const
+    {
+        if (!node)
+            return 0;
+
+        size_t result = node->line_breaks.load(std::memory_order_relaxed);
+
+        if (result == unknown_line_breaks)
+        {
+            const size_t piece_breaks = lines_of(node->piece.source).count(buffer_of(node->piece.source), node->piece.start, node->piece.length);
+            result = line_breaks(node->left.get()) + piece_breaks + line_breaks(node->right.get());
+            node->line_breaks.store(result, std::memory_order_relaxed);
+        }
+
+        return result;
+    }
+
+    size_t piece_line_breaks(const Node* node) const
+    {
+        return line_breaks(node) - line_breaks(node->left.get()) - line_breaks(node->right.get());
+    }
+
+    BufferRange range_of(const Piece& piece) const
+    {
+        const void* buffer = piece.source == Source::original ? static_cast<const void*>(original_.data()) : added_.get();
+
+        return BufferRange{buffer, piece.start, piece.start + piece.length};
+    }
+
+    // sorted by buffer and start - overlapping ranges are merged
+    static void merge_ranges(std::vector<BufferRange>& ranges)
+    {
+        std::sort(ranges.begin(), ranges.end(), [](const BufferRange& a, const BufferRange& b) {
+            return a.buffer != b.buffer ? std::less<>{}(a.buffer, b.buffer) : a.start < b.start;
+        });
+
+        size_t merged = 0;
+
+        for (const auto& range : ranges)
+        {
+            if (merged > 0 && ranges[merged - 1].buffer == range.buffer && range.start <= ranges[merged - 1].end)
+                ranges[merged - 1].end = std::max(ranges[merged - 1].end, range.end);
+            else
+                ranges[merged++] = range;
+        }
+
+        ranges.resize(merged);
+    }
+
+    // bytes of the ranges that are not covered by any of the excluded ranges
+    static size_t uncovered_bytes(std::vector<BufferRange> ranges, std::vector<BufferRange> excluded)
+    {
+        merge_ranges(ranges);
+        merge_ranges(excluded);
+
+        size_t result = 0;
+        auto first_excluded = excluded.begin();
+
+        for (const auto& range : ranges)
+        {
+            while (first_excluded != excluded.end()
+                && (first_excluded->buffer != range.buffer ? std::less<>{}(first_excluded->buffer, range.buffer) : first_excluded->end <= range.start))
+                ++first_excluded;
+
+            size_t pos = range.start;
+
+            for (auto it = first_excluded; it != excluded.end() && it->buffer == range.buffer && it->start < range.end; ++it)
+            {
+                if (it->start > pos)
+                    result += it->start - pos;
+
+                pos = std::max(pos, it->end);
+            }
+
+            if (pos < range.end)
+                result += range.end - pos;
+        }
+
+        return result;
+    }
+
+    static void compact_buffer(const AddedBuffer& buffer, const std::vector<PieceTable*>& tables)
+    {
+        std::unordered_set<const Node*> visited;
+        std::vector<BufferRange> live;
+
+        auto collect = [&](auto& self, const NodePtr& node) -> void {
+            if (!node || !visited.insert(node.get()).second)
+                return;
+
+            if (node->piece.source == Source::added)
+                live.push_back(BufferRange{&buffer, node->piece.start, node->piece.start + node->piece.length});
+
+            self(self, node->left);
+            self(self, node->right);
+        };
+
+        for (PieceTable* table : tables)
+            collect(collect, table->root_);
+
+        merge_ranges(live);
+
+        auto compacted = std::make_shared<AddedBuffer>();
+        std::vector<size_t> new_starts;
+        new_starts.reserve(live.size());
+
+        for (const auto& range : live)
+        {
+            new_starts.push_back(compacted->text.size());
+            compacted->text.append(buffer.text, range.start, range.end - range.start);
+        }
+
+        if (compacted->text.size() == buffer.text.size())
+            return;
+
+        auto moved = [&](size_t pos) {
+            const auto next = std::upper_bound(live.begin(), live.end(), pos, [](size_t value, const BufferRange& range) { return value < range.start; });
+            const size_t index = static_cast<size_t>(next - live.begin()) - 1;
+
+            return new_starts[index] + (pos - live[index].start);
+        };
+
+        std::unordered_map<const Node*, NodePtr> copies;
+
+        auto copy = [&](auto& self, const NodePtr& node) -> NodePtr {
+            if (!node)
+                return nullptr;
+
+            if (auto it = copies.find(node.get()); it != copies.end())
+                return it->second;
+
+            Piece piece = node->piece;
+            if (piece.source == Source::added)
+                piece.start = moved(piece.start);
+
+            // children first - the copy must be created after them
+            NodePtr left = self(self, node->left);
+            NodePtr right = self(self, node->right);
+
+            auto result = std::make_shared<const Node>(piece, node->priority, next_serial(), std::move(left), std::move(right), node->length, node->pieces, node->line_breaks.load(std::memory_order_relaxed));
+            copies.emplace(node.get(), result);
+
+            return result;
+        };
+
+        for (PieceTable* table : tables)
+        {
+            table->root_ = copy(copy, table->root_);
+            table->added_ = compacted;
+        }
+    }
+
+    std::uint32_t next_priority()
+    {
+        // xorshift32
+        random_state_ ^= random_state_ << 13;
+        random_state_ ^= random_state_ >> 17;
+        random_state_ ^= random_state_ << 5;
+
+        return random_state_;
+    }
+
+    static size_t length(const NodePtr& node)
+    {
+        return node ? node->length : 0;
+    }
+
+    static size_t count(const NodePtr& node)
+    {
+        return node ? node->pieces : 0;
+    }
+
+    static NodePtr make_node(NodePtr left, const Piece& piece, std::uint32_t priority, NodePtr right)
+    {
+        const size_t subtree_length = length(left) + piece.length + length(right);
+        const size_t subtree_pieces = count(left) + 1 + count(right);
+
+        return std::make_shared<const Node>(piece, priority, next_serial(), std::move(left), std::move(right), subtree_length, subtree_pieces, unknown_line_breaks);
+    }
+
+    // tables may be changed concurrently
+    static std::uint64_t next_serial()
+    {
+        static std::atomic<std::uint64_t> serial{0};
+
+        return serial.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::string_view view(const Piece& piece) const
+    {
+        return buffer_of(piece.source).substr(piece.start, piece.length);
+    }
+
+    // first pos characters go to the first tree - a piece containing pos is cut in two
+    static std::pair<NodePtr, NodePtr> split(const NodePtr& node, size_t pos)
+    {
+        if (!node)
+            return {};
+
+        const size_t left_length = length(node->left);
+
+        if (pos <= left_length)
+        {
+            auto [left, right] = split(node->left, pos);
+            return {std::move(left), make_node(std::move(right), node->piece, node->priority, node->right)};
+        }
+
+        pos -= left_length;
+
+        if (pos < node->piece.length)
+        {
+            const Piece head{node->piece.source, node->piece.start, pos};
+            const Piece tail{node->piece.source, node->piece.start + pos, node->piece.length - pos};
+
+            return {make_node(node->left, head, node->priority, nullptr), make_node(nullptr, tail, node->priority, node->right)};
+        }
+
+        auto [left, right] = split(node->right, pos - node->piece.length);
+        return {make_node(node->left, node->piece, node->priority, std::move(left)), std::move(right)};
+    }
+
+    static NodePtr merge(const NodePtr& left, const NodePtr& right)
+    {
+        if (!left)
+            return right;
+
+        if (!right)
+            return left;
+
+        if (left->priority > right->priority)
+            return make_node(left->left, left->piece, left->priority, merge(left->right, right));
+
+        return make_node(merge(left, right->left), right->piece, right->priority, right->right);
+    }
+
+    void flatten(const std::vector<Piece>& pieces, size_t text_size)
+    {
+        std::string text;
+        text.reserve(text_size);
+
+        for (const auto& piece : pieces)
+            text.append(view(piece));
+
+        *this = PieceTable{std::move(text)};
+    }
+
+    // treap of pieces in the given order in O(n) - nodes with random priorities are linked
+    // into a Cartesian tree with a stack of its right spine, then created bottom-up
+    NodePtr build(const std::vector<Piece>& pieces)
+    {
+        constexpr size_t none = static_cast<size_t>(-1);
+
+        std::vector<std::uint32_t> priorities(pieces.size());
+        std::vector<size_t> left(pieces.size(), none);
+        std::vector<size_t> right(pieces.size(), none);
+        std::vector<size_t> right_spine;
+
+        for (size_t i = 0; i < pieces.size(); ++i)
+        {
+            priorities[i] = next_priority();
+
+            size_t last_popped = none;
+            while (!right_spine.empty() && priorities[right_spine.back()] < priorities[i])
+            {
+                last_popped = right_spine.back();
+                right_spine.pop_back();
+            }
+
+            left[i] = last_popped;
+
+            if (!right_spine.empty())
+                right[right_spine.back()] = i;
+
+            right_spine.push_back(i);
+        }
+
+        auto make_subtree = [&](auto& self, size_t i) -> NodePtr {
+            if (i == none)
+                return nullptr;
+
+            return make_node(self(self, left[i]), pieces[i], priorities[i], self(self, right[i]));
+        };
+
+        return right_spine.empty() ? nullptr : make_subtree(make_subtree, right_spine.front());
+    }
+
+    // typing appends to the piece that ends where the added text starts - no new piece is created
+    bool extend_last_piece(NodePtr& node, size_t added_start, size_t added_length) const
+    {
+        if (!node)
+            return false;
+
+        if (node->right)
+        {
+            NodePtr right = node->right;
+
+            if (!extend_last_piece(right, added_start, added_length))
+                return false;
+
+            node = make_node(node->left, node->piece, node->priority, std::move(right));
+            return true;
+        }
+
+        const Piece& piece = node->piece;
+
+        if (piece.source != Source::added || piece.start + piece.length != added_start)
+            return false;
+
+        node = make_node(node->left, Piece{piece.source, piece.start, piece.length + added_length}, node->priority, nullptr);
+        return true;
+    }
+
+    template <typename F>
+    static void for_each_piece(const NodePtr& node, F& f)
+    {
+        if (!node)
+            return;
+
+        for_each_piece(node->left, f);
+        f(node->piece);
+        for_each_piece(node->right, f);
+    }
+
+    template <typename F>
+    void for_each_chunk(const NodePtr& node, F& f) const
+    {
+        if (!node)
+            return;
+
+        for_each_chunk(node->left, f);
+        f(view(node->piece));
+        for_each_chunk(node->right, f);
+    }
+
+    void check_position(size_t pos) const
+    {
+        if (pos > size())
+            throw std::out_of_range("position is out of the text");
+    }
+
+    void check_ranges(std::span<const TextRange> ranges) const
+    {
+        size_t end = 0;
+
+        for (const auto& range : ranges)
+        {
+            if (range.pos < end)
+                throw std::invalid_argument("ranges must be sorted and must not overlap");
+
+            end = range.pos + range.length;
+        }
+
+        if (end > size())
+            throw std::out_of_range("range is out of the text");
+    }
+};
+
+#endif // PIECE_TABLE_HPP
@@ -0,0 +1,174 @@
+#ifndef TEXT_SEARCH_HPP
+#define TEXT_SEARCH_HPP
+
+#include "document.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TEXT_SEARCH_SSE2
+#endif
+
+// Find and replace of all occurrences in a document.
+// Literal patterns are searched chunk by chunk in the pieces of the document (no copy of the text):
+// candidates are filtered 16 positions at a time by the first and the last byte of the pattern
+// and only then compared. Matches are leftmost and do not overlap.
+namespace TextSearch
+{
+    namespace Detail
+    {
+        constexpr size_t npos = std::string_view::npos;
+
+        // first occurrence of a non-empty pattern at from or later
+        inline size_t find(std::string_view text, std::string_view pattern, size_t from)
+        {
+            const size_t m = pattern.size();
+
+            if (text.size() < m)
+                return npos;
+
+            const size_t last_start = text.size() - m;
+
+#ifdef TEXT_SEARCH_SSE2
+            if (m > 1)
+            {
+                const __m128i first_byte = _mm_set1_epi8(pattern.front());
+                const __m128i last_byte = _mm_set1_epi8(pattern.back());
+
+                for (; from + 15 <= last_start; from += 16)
+                {
+                    const char* block = text.data() + from;
+                    const __m128i firsts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+                    const __m128i lasts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + m - 1));
+
+                    auto candidates = static_cast<unsigned>(
+                        _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(firsts, first_byte), _mm_cmpeq_epi8(lasts, last_byte))));
+
+                    for (; candidates != 0; candidates &= candidates - 1)
+                    {
+                        const size_t offset = std::countr_zero(candidates);
+
+                        if (std::memcmp(block + offset + 1, pattern.data() + 1, m - 2) == 0)
+                            return from + offset;
+                    }
+                }
+            }
+#endif
+            while (from <= last_start)
+            {
+                const void* hit = std::memchr(text.data() + from, pattern.front(), last_start - from + 1);
+
+                if (!hit)
+                    return npos;
+
+                from = static_cast<const char*>(hit) - text.data();
+
+                if (std::memcmp(text.data() + from + 1, pattern.data() + 1, m - 1) == 0)
+                    return from;
+
+                ++from;
+            }
+
+            return npos;
+        }
+    } // namespace Detail
+
+    // matches may cross boundaries of chunks - the last pattern.size() - 1 bytes of the text seen so far
+    // (starts of matches not yet decided) are kept and searched together with the beginning of the next chunk
+    inline std::vector<TextRange> find_all(const Document& doc, std::string_view pattern)
+    {
+        if (pattern.empty())
+            throw std::invalid_argument("pattern must not be empty");
+
+        const size_t m = pattern.size();
+
+        std::vector<TextRange> matches;
+        size_t next = 0; // matches must not start before
+
+        auto search = [&](std::string_view text, size_t text_base, size_t starts_limit) {
+            size_t from = next > text_base ? next - text_base : 0;
+
+            for (size_t pos = Detail::find(text, pattern, from); pos < starts_limit; pos = Detail::find(text, pattern, pos + m))
+            {
+                matches.push_back(TextRange{text_base + pos, m});
+                next = text_base + pos + m;
+            }
+        };
+
+        std::string pending; // undecided starts
+        size_t pending_base = 0;
+        size_t base = 0;
+
+        for (std::string_view chunk : doc.chunks())
+        {
+            if (chunk.size() < m - 1)
+            {
+                pending.append(chunk);
+                search(pending, pending_base, Detail::npos);
+
+                const size_t undecided = std::min(pending.size(), m - 1);
+                pending_base += pending.size() - undecided;
+                pending.erase(0, pending.size() - undecided);
+            }
+            else
+            {
+                if (!pending.empty())
+                {
+                    const std::string boundary = pending + std::string{chunk.substr(0, m - 1)};
+                    search(boundary, pending_base, pending.size());
+                }
+
+                search(chunk, base, Detail::npos);
+
+                pending.assign(chunk.substr(chunk.size() - (m - 1)));
+                pending_base = base + chunk.size() - (m - 1);
+            }
+
+            base += chunk.size();
+        }
+
+        return matches;
+    }
+
+    // regular expressions need the text in one piece - it is copied when the document is fragmented
+    inline std::vector<TextRange> find_all(const Document& doc, const std::regex& pattern)
+    {
+        std::string copy;
+        std::string_view text;
+
+        if (auto view = doc.text_view())
+            text = *view;
+        else
+        {
+            copy = doc.text();
+            text = copy;
+        }
+
+        std::vector<TextRange> matches;
+
+        for (std::cregex_iterator it{text.data(), text.data() + text.size(), pattern}, end; it != end; ++it)
+            matches.push_back(TextRange{static_cast<size_t>(it->position()), static_cast<size_t>(it->length())});
+
+        return matches;
+    }
+
+    // all matches are replaced as a single change of the document - returns the number of replacements
+    template <typename TPattern>
+    size_t replace_all(Document& doc, const TPattern& pattern, std::string_view replacement)
+    {
+        const std::vector<TextRange> matches = find_all(doc, pattern);
+        doc.replace_all(matches, replacement);
+
+        return matches.size();
+    }
+} // namespace TextSearch
+
+#endif // TEXT_SEARCH_HPP
@@ -220,6 +220,28 @@ TEST(PrintCmd_Execute, PrintsDocumentInConsole)
     cmd.execute();
 }
 
+TEST(PrintCmd_Execute, PrintsFragmentsOfDocumentWithoutCopyingIt)
+{
+    struct FragmentsConsole : NiceMock<MockConsole>
+    {
+        std::vector<std::string_view> fragments;
+
+        void print_fragments(std::span<const std::string_view> printed) override
+        {
+            fragments.assign(printed.begin(), printed.end());
+        }
+    } console;
+
+    Document doc{"abc"};
+    doc.add_text("def");
+
+    PrintCmd cmd{doc, console};
+    cmd.execute();
+
+    ASSERT_THAT(console.fragments, ElementsAre("[", "abc", "def", "]"));
+    ASSERT_EQ(console.fragments[1].data(), (*doc.chunks().begin()).data());
+}
+
 //////////////////////////////////////////////////////////
 
 TEST(AddText_Execute, GetsTextFromConsoleAndAddsToDocument)
@@ -233,4 +255,80 @@ TEST(AddText_Execute, GetsTextFromConsoleAndAddsToDocument)
     cmd.execute();
 
     ASSERT_EQ(doc.text(), "abcdef");
-}
\ No newline at end of file
+}
+
+//////////////////////////////////////////////////////////
+
+struct UndoRedo_Execute : Test
+{
+    NiceMock<MockConsole> console;
+    Document doc{"abc"};
+    History history{doc};
+    UndoableCmd add_text{std::make_shared<AddText>(doc, console), history};
+    UndoCmd undo{history, console};
+    RedoCmd redo{history, console};
+};
+
+TEST_F(UndoRedo_Execute, UndoRevertsUndoableCommand)
+{
+    EXPECT_CALL(console, get_line()).WillOnce(Return("def"));
+
+    add_text.execute();
+    undo.execute();
+
+    ASSERT_EQ(doc.text(), "abc");
+}
+
+TEST_F(UndoRedo_Execute, RedoRepeatsUndoneCommand)
+{
+    EXPECT_CALL(console, get_line()).WillOnce(Return("def"));
+
+    add_text.execute();
+    undo.execute();
+    redo.execute();
+
+    ASSERT_EQ(doc.text(), "abcdef");
+}
+
+TEST_F(UndoRedo_Execute, PrintsMessageWhenThereIsNothingToUndoOrRedo)
+{
+    EXPECT_CALL(console, print("Nothing to undo"));
+    EXPECT_CALL(console, print("Nothing to redo"));
+
+    undo.execute();
+    redo.execute();
+}
+
+//////////////////////////////////////////////////////////
+
+TEST(OpenCmd_Execute, PrintsErrorWhenFileCannotBeOpened)
+{
+    NiceMock<MockConsole> console;
+    Document doc{"abc"};
+
+    EXPECT_CALL(console, get_line()).WillOnce(Return("/no/such/dir/file.txt"));
+    EXPECT_CALL(console, print("> Enter file path:"));
+    EXPECT_CALL(console, print(StartsWith("Error: ")));
+
+    OpenCmd cmd{doc, console};
+    cmd.execute();
+
+    ASSERT_EQ(doc.text(), "abc");
+}
+
+//////////////////////////////////////////////////////////
+
+TEST(ReplaceCmd_Execute, ReplacesAllOccurrencesAndPrintsTheirNumber)
+{
+    NiceMock<MockConsole> console;
+    Document doc{"one two one"};
+
+    EXPECT_CALL(console, get_line()).WillOnce(Return("one")).WillOnce(Return("1"));
+    EXPECT_CALL(console, print(_)).Times(AnyNumber());
+    EXPECT_CALL(console, print("Replaced 2 matches"));
+
+    ReplaceCmd cmd{doc, console};
+    cmd.execute();
+
+    ASSERT_EQ(doc.text(), "1 two 1");
+}
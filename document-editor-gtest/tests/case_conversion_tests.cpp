@@ -0,0 +1,85 @@
+#include <algorithm>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "case_conversion.hpp"
+
+using namespace ::testing;
+using namespace CaseConversion;
+
+namespace
+{
+    std::string converted(std::string text, Case target)
+    {
+        convert(text, target);
+        return text;
+    }
+} // namespace
+
+TEST(CaseConversion_Ascii, LettersChangeCase)
+{
+    ASSERT_THAT(converted("abcXYZ", Case::upper), StrEq("ABCXYZ"));
+    ASSERT_THAT(converted("abcXYZ", Case::lower), StrEq("abcxyz"));
+}
+
+TEST(CaseConversion_Ascii, OtherCharactersAreNotChanged)
+{
+    const std::string text = "@[`{ 09\t\n~\x7f";
+
+    ASSERT_EQ(converted(text, Case::upper), text);
+    ASSERT_EQ(converted(text, Case::lower), text);
+}
+
+TEST(CaseConversion_Ascii, LongTextIsConvertedInBlocksAndTail)
+{
+    std::string text;
+    for (int i = 0; i < 1'000; ++i)
+        text += static_cast<char>(i % 128);
+
+    std::string expected = text;
+    std::transform(expected.begin(), expected.end(), expected.begin(), [](char c) { return (c >= 'a' && c <= 'z') ? c - 32 : c; });
+
+    ASSERT_EQ(converted(text, Case::upper), expected);
+}
+
+TEST(CaseConversion_Utf8, LatinLettersChangeCase)
+{
+    ASSERT_THAT(converted("zażółć gęślą jaźń ÿ", Case::upper), StrEq("ZAŻÓŁĆ GĘŚLĄ JAŹŃ Ÿ"));
+    ASSERT_THAT(converted("ZAŻÓŁĆ GĘŚLĄ JAŹŃ ß ÀÉÎ", Case::lower), StrEq("zażółć gęślą jaźń ß àéî"));
+}
+
+TEST(CaseConversion_Utf8, GreekAndCyrillicLettersChangeCase)
+{
+    ASSERT_THAT(converted("αβγ λόγος", Case::upper), StrEq("ΑΒΓ ΛόΓΟΣ"));
+    ASSERT_THAT(converted("Привет, Ёж", Case::upper), StrEq("ПРИВЕТ, ЁЖ"));
+    ASSERT_THAT(converted("ПРИВЕТ, ЁЖ", Case::lower), StrEq("привет, ёж"));
+}
+
+TEST(CaseConversion_Utf8, LettersWithoutSameLengthCounterpartAreNotChanged)
+{
+    ASSERT_THAT(converted("ıſ€ß", Case::upper), StrEq("ıſ€ß"));
+    ASSERT_THAT(converted("İ€", Case::lower), StrEq("İ€"));
+}
+
+TEST(CaseConversion_Utf8, InvalidBytesAreNotChanged)
+{
+    const std::string text = "a\x80\xff\xc3z\xc3";
+
+    ASSERT_EQ(converted(text, Case::upper), "A\x80\xff\xc3Z\xc3");
+}
+
+TEST(CaseConversion_Parallel, MatchesSerialConversion)
+{
+    std::string text;
+    while (text.size() < 4 * parallel_threshold)
+        text += "aą ż Ж b";
+
+    std::string expected = text;
+    convert(expected, Case::upper);
+
+    convert_parallel(text, Case::upper, 7);
+
+    ASSERT_EQ(text, expected);
+}
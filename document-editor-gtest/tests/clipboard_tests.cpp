@@ -0,0 +1,84 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "clipboard.hpp"
+
+using namespace ::testing;
+
+TEST(SharedClipboard_Instance, IsTheSameObject)
+{
+    ASSERT_EQ(&SharedClipboard::instance(), &SharedClipboard::instance());
+}
+
+TEST(SharedClipboard_Content, IsEmptyAtStart)
+{
+    SharedClipboard clipboard;
+
+    ASSERT_THAT(clipboard.content(), StrEq(""));
+}
+
+TEST(SharedClipboard_Content, ReturnsLastSetContent)
+{
+    SharedClipboard clipboard;
+
+    clipboard.set_content("abc");
+    clipboard.set_content("def");
+
+    ASSERT_THAT(clipboard.content(), StrEq("def"));
+}
+
+TEST(SharedClipboard_Snapshot, SharesContentWithoutCopy)
+{
+    SharedClipboard clipboard;
+    clipboard.set_content(std::string(1024, 'x'));
+
+    ASSERT_EQ(clipboard.snapshot(), clipboard.snapshot());
+}
+
+TEST(SharedClipboard_Snapshot, IsNotChangedBySetContent)
+{
+    SharedClipboard clipboard;
+    clipboard.set_content("abc");
+
+    auto snapshot = clipboard.snapshot();
+    clipboard.set_content("def");
+
+    ASSERT_THAT(*snapshot, StrEq("abc"));
+}
+
+TEST(SharedClipboard_Concurrency, ReadersAlwaysSeeWholeContent)
+{
+    SharedClipboard clipboard;
+    clipboard.set_content(std::string(1000, 'a'));
+
+    std::atomic<bool> torn_read{false};
+
+    {
+        std::vector<std::jthread> threads;
+
+        threads.emplace_back([&] {
+            for (int i = 0; i < 1'000; ++i)
+                clipboard.set_content(std::string(1000 + i % 7, static_cast<char>('a' + i % 26)));
+        });
+
+        for (int t = 0; t < 3; ++t)
+        {
+            threads.emplace_back([&] {
+                for (int i = 0; i < 1'000; ++i)
+                {
+                    auto snapshot = clipboard.snapshot();
+
+                    if (snapshot->find_first_not_of(snapshot->front()) != std::string::npos)
+                        torn_read = true;
+                }
+            });
+        }
+    }
+
+    ASSERT_FALSE(torn_read);
+}
@@ -0,0 +1,226 @@
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "application.hpp"
+#include "command_executor.hpp"
+#include "mocks/mocks.hpp"
+
+using namespace ::testing;
+
+namespace
+{
+    class RecordingCmd : public Command
+    {
+        std::vector<std::string>& log_;
+        std::string name_;
+
+    public:
+        RecordingCmd(std::vector<std::string>& log, std::string name)
+            : log_(log), name_(std::move(name))
+        {
+        }
+
+        void execute() override
+        {
+            log_.push_back(name_);
+        }
+    };
+
+    // reads its argument and releases the blocked worker - the work records the argument
+    class ReleasingCmd : public InteractiveCmd
+    {
+        Console& console_;
+        std::vector<std::string>& log_;
+        std::promise<void>& release_;
+
+    public:
+        ReleasingCmd(Console& console, std::vector<std::string>& log, std::promise<void>& release)
+            : console_(console), log_(log), release_(release)
+        {
+        }
+
+        std::shared_ptr<Command> prepare() override
+        {
+            auto work = std::make_shared<RecordingCmd>(log_, console_.get_line());
+            release_.set_value();
+
+            return work;
+        }
+    };
+
+    class BlockingCmd : public Command
+    {
+        std::shared_future<void> released_;
+
+    public:
+        explicit BlockingCmd(std::shared_future<void> released)
+            : released_(std::move(released))
+        {
+        }
+
+        void execute() override
+        {
+            released_.wait();
+        }
+    };
+
+    class ThrowingCmd : public Command
+    {
+    public:
+        void execute() override
+        {
+            throw std::runtime_error("failed");
+        }
+    };
+} // namespace
+
+TEST(InlineExecutor, ExecutesCommandBeforeSubmitReturns)
+{
+    std::vector<std::string> log;
+    InlineExecutor executor;
+
+    auto ticket = executor.submit(std::make_shared<RecordingCmd>(log, "cmd"));
+
+    ASSERT_THAT(log, ElementsAre("cmd"));
+    ASSERT_EQ(ticket.state(), CommandTicket::State::done);
+}
+
+TEST(InlineExecutor, PropagatesExceptionOfCommand)
+{
+    InlineExecutor executor;
+
+    ASSERT_THROW(executor.submit(std::make_shared<ThrowingCmd>()), std::runtime_error);
+}
+
+//////////////////////////////////////////////////////////
+
+TEST(WorkerExecutor, ExecutesCommandsInOrderOfSubmission)
+{
+    std::vector<std::string> log;
+    WorkerExecutor executor;
+
+    for (int i = 0; i < 100; ++i)
+        executor.submit(std::make_shared<RecordingCmd>(log, std::to_string(i)));
+
+    executor.drain();
+
+    ASSERT_EQ(log.size(), 100u);
+    for (int i = 0; i < 100; ++i)
+        ASSERT_EQ(log[i], std::to_string(i));
+}
+
+TEST(WorkerExecutor, TicketRethrowsExceptionOfCommand)
+{
+    WorkerExecutor executor;
+
+    auto ticket = executor.submit(std::make_shared<ThrowingCmd>());
+
+    ASSERT_THROW(ticket.wait(), std::runtime_error);
+    ASSERT_EQ(ticket.state(), CommandTicket::State::failed);
+}
+
+TEST(WorkerExecutor, QueuedCommandCanBeCancelled)
+{
+    std::vector<std::string> log;
+    std::promise<void> release;
+    WorkerExecutor executor;
+
+    auto running = executor.submit(std::make_shared<BlockingCmd>(release.get_future().share()));
+    auto queued = executor.submit(std::make_shared<RecordingCmd>(log, "cancelled"));
+
+    while (running.state() != CommandTicket::State::running)
+        std::this_thread::yield();
+
+    ASSERT_TRUE(queued.cancel());
+    ASSERT_FALSE(queued.cancel());
+    ASSERT_FALSE(running.cancel());
+
+    release.set_value();
+    executor.drain();
+
+    ASSERT_THAT(log, IsEmpty());
+    ASSERT_EQ(queued.state(), CommandTicket::State::cancelled);
+    ASSERT_EQ(running.state(), CommandTicket::State::done);
+}
+
+TEST(WorkerExecutor, CancelPendingCancelsAllQueuedCommands)
+{
+    std::vector<std::string> log;
+    std::promise<void> release;
+    WorkerExecutor executor;
+
+    auto running = executor.submit(std::make_shared<BlockingCmd>(release.get_future().share()));
+    while (running.state() != CommandTicket::State::running)
+        std::this_thread::yield();
+
+    executor.submit(std::make_shared<RecordingCmd>(log, "a"));
+    executor.submit(std::make_shared<RecordingCmd>(log, "b")).cancel();
+    executor.submit(std::make_shared<RecordingCmd>(log, "c"));
+
+    ASSERT_EQ(executor.cancel_pending(), 2u);
+
+    release.set_value();
+    executor.drain();
+
+    ASSERT_THAT(log, IsEmpty());
+}
+
+TEST(WorkerExecutor, QueuedCommandsAreExecutedBeforeDestruction)
+{
+    std::vector<std::string> log;
+
+    {
+        WorkerExecutor executor;
+        executor.submit(std::make_shared<RecordingCmd>(log, "a"));
+        executor.submit(std::make_shared<RecordingCmd>(log, "b"));
+    }
+
+    ASSERT_THAT(log, ElementsAre("a", "b"));
+}
+
+//////////////////////////////////////////////////////////
+
+TEST(Application_WorkerExecutor, ArgumentsAreReadWhileSubmittedCommandsRun)
+{
+    NiceMock<MockConsole> console;
+    std::vector<std::string> log;
+    std::promise<void> release;
+
+    Application app{console, std::make_shared<WorkerExecutor>()};
+    app.add_command("slow", std::make_shared<BlockingCmd>(release.get_future().share()));
+    app.add_command("print", std::make_shared<RecordingCmd>(log, "print"));
+    app.add_command("addtext", std::make_shared<ReleasingCmd>(console, log, release));
+
+    EXPECT_CALL(console, get_line())
+        .WillOnce(Return("slow"))
+        .WillOnce(Return("print"))
+        .WillOnce(Return("addtext"))
+        .WillOnce(Return("text"))
+        .WillOnce(Return("print"))
+        .WillOnce(Return("exit"));
+
+    ASSERT_EQ(app.run(), 0);
+    ASSERT_THAT(log, ElementsAre("print", "text", "print"));
+}
+
+TEST(Application_WorkerExecutor, FailuresOfSubmittedCommandsArePrinted)
+{
+    NiceMock<MockConsole> console;
+
+    Application app{console, std::make_shared<WorkerExecutor>()};
+    app.add_command("fail", std::make_shared<ThrowingCmd>());
+
+    EXPECT_CALL(console, get_line())
+        .WillOnce(Return("fail"))
+        .WillOnce(Return("exit"));
+    EXPECT_CALL(console, print(_)).Times(AnyNumber());
+    EXPECT_CALL(console, print("Error: failed")).Times(1);
+
+    ASSERT_EQ(app.run(), 0);
+}
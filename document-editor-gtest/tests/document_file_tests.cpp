@@ -0,0 +1,115 @@
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "document_file.hpp"
+
+using namespace ::testing;
+
+struct DocumentFileTests : Test
+{
+    std::filesystem::path path = std::filesystem::temp_directory_path()
+        / ("document_file_tests_" + std::string{UnitTest::GetInstance()->current_test_info()->name()} + ".txt");
+
+    void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+
+    void write_file(const std::string& content)
+    {
+        std::ofstream out{path, std::ios::binary};
+        out << content;
+    }
+
+    std::string read_file()
+    {
+        std::ifstream in{path, std::ios::binary};
+        return std::string{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+    }
+};
+
+TEST_F(DocumentFileTests, LoadReplacesTextOfDocument)
+{
+    write_file("line1\nline2\n");
+    Document doc{"abc"};
+
+    load_document(doc, path);
+
+    ASSERT_THAT(doc.text(), StrEq("line1\nline2\n"));
+}
+
+TEST_F(DocumentFileTests, SavedFileContainsEditedText)
+{
+    write_file("hello world");
+    Document doc;
+    load_document(doc, path);
+
+    doc.replace(0, 5, "HELLO");
+    doc.add_text("!");
+    save_document(doc, path);
+
+    ASSERT_THAT(read_file(), StrEq("HELLO world!"));
+    ASSERT_THAT(doc.text(), StrEq("HELLO world!"));
+}
+
+TEST_F(DocumentFileTests, SavingOverLoadedFileKeepsDocumentAndUndoValid)
+{
+    write_file("abc");
+    Document doc;
+    load_document(doc, path);
+    auto memento = doc.create_shared_memento();
+
+    doc.add_text("def");
+    save_document(doc, path);
+    doc.set_memento(memento);
+
+    ASSERT_THAT(doc.text(), StrEq("abc"));
+    ASSERT_THAT(read_file(), StrEq("abcdef"));
+}
+
+TEST_F(DocumentFileTests, SavesDocumentWithManyPieces)
+{
+    Document doc;
+    std::string expected;
+
+    for (int i = 0; i < 3000; ++i)
+    {
+        std::string word = std::to_string(i) + ",";
+        doc.insert(0, word);
+        expected.insert(0, word);
+    }
+
+    save_document(doc, path);
+
+    ASSERT_EQ(read_file(), expected);
+}
+
+TEST_F(DocumentFileTests, EmptyFileLoadsEmptyDocument)
+{
+    write_file("");
+    Document doc{"abc"};
+
+    load_document(doc, path);
+
+    ASSERT_EQ(doc.length(), 0u);
+}
+
+TEST_F(DocumentFileTests, LoadingMissingFileThrowsAndKeepsDocument)
+{
+    Document doc{"abc"};
+
+    ASSERT_THROW(load_document(doc, path), std::runtime_error);
+    ASSERT_THAT(doc.text(), StrEq("abc"));
+}
+
+TEST_F(DocumentFileTests, SavingToMissingDirectoryThrows)
+{
+    Document doc{"abc"};
+
+    ASSERT_THROW(save_document(doc, path / "missing" / "file.txt"), std::runtime_error);
+}
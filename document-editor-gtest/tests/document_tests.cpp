@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <random>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -41,6 +42,12 @@ TEST_F(Document_ValueConstructed, Length)
     ASSERT_THAT(doc.length(), Eq(3));
 }
 
+TEST_F(Document_ValueConstructed, TextIsAccessibleWithoutCopy)
+{
+    ASSERT_EQ(doc.text_view(), "abc");
+    ASSERT_THAT(std::vector<std::string_view>(doc.chunks().begin(), doc.chunks().end()), ElementsAre("abc"));
+}
+
 struct Document_Clear : Document_ValueConstructed
 {
 };
@@ -93,6 +100,25 @@ TEST_F(Document_ReplacingText, TextIsReplaced)
     ASSERT_THAT(doc.text(), StrEq("xyzc"));
 }
 
+TEST_F(Document_ReplacingText, TextIsInserted)
+{
+    doc.insert(1, "xyz");
+
+    ASSERT_THAT(doc.text(), StrEq("axyzbc"));
+}
+
+TEST_F(Document_ReplacingText, TextIsErased)
+{
+    doc.erase(1, 1);
+
+    ASSERT_THAT(doc.text(), StrEq("ac"));
+}
+
+TEST_F(Document_ReplacingText, PositionOutOfTextThrows)
+{
+    ASSERT_THROW(doc.replace(4, 1, "x"), std::out_of_range);
+}
+
 struct Document_Memento : Document_ValueConstructed
 {
 };
@@ -104,4 +130,156 @@ TEST_F(Document_Memento, RestoresThePreviousState)
     doc.set_memento(snaphot);
 
     ASSERT_THAT(doc.text(), StrEq("abc"));
-}
\ No newline at end of file
+}
+
+TEST_F(Document_Memento, RestoresRevisionOfItsState)
+{
+    auto snaphot = doc.create_memento();
+    const size_t revision = doc.revision();
+
+    doc.add_text("def");
+    doc.set_memento(snaphot);
+
+    ASSERT_EQ(doc.revision(), revision);
+}
+
+struct Document_SharedMemento : Document_ValueConstructed
+{
+};
+
+TEST_F(Document_SharedMemento, RestoresThePreviousState)
+{
+    auto memento = doc.create_shared_memento();
+    doc.add_text("def");
+    doc.replace(0, 1, "x");
+    doc.set_memento(memento);
+
+    ASSERT_THAT(doc.text(), StrEq("abc"));
+}
+
+TEST_F(Document_SharedMemento, RestoresLaterStateAfterUndo)
+{
+    auto before = doc.create_shared_memento();
+    doc.add_text("def");
+    doc.erase(0, 1);
+    auto after = doc.create_shared_memento();
+
+    doc.set_memento(before);
+    doc.set_memento(after);
+
+    ASSERT_THAT(doc.text(), StrEq("bcdef"));
+}
+
+TEST_F(Document_SharedMemento, RestoresStateBeforeWholeTextChanges)
+{
+    doc.add_text("def");
+    auto memento = doc.create_shared_memento();
+    doc.to_upper();
+    doc.clear();
+
+    doc.set_memento(memento);
+
+    ASSERT_THAT(doc.text(), StrEq("abcdef"));
+}
+
+TEST_F(Document_SharedMemento, RestoresStateOfAbandonedBranchOfEdits)
+{
+    auto start = doc.create_shared_memento();
+    doc.add_text("1");
+    auto branch_1 = doc.create_shared_memento();
+
+    doc.set_memento(start);
+    doc.add_text("2");
+
+    doc.set_memento(branch_1);
+
+    ASSERT_THAT(doc.text(), StrEq("abc1"));
+}
+
+TEST_F(Document_SharedMemento, RestoresRevisionOfItsState)
+{
+    auto memento = doc.create_shared_memento();
+    const size_t revision = doc.revision();
+
+    doc.add_text("def");
+    ASSERT_NE(doc.revision(), revision);
+
+    doc.set_memento(memento);
+    ASSERT_EQ(doc.revision(), revision);
+}
+
+TEST_F(Document_SharedMemento, RevisionIsNotChangedWhenTextIsNotChanged)
+{
+    const size_t revision = doc.revision();
+
+    doc.add_text("");
+    doc.erase(1, 0);
+    doc.replace(3, 5, "");
+    doc.replace_all({}, "x");
+
+    ASSERT_EQ(doc.revision(), revision);
+}
+
+TEST(Document_SharedMemento_RandomEdits, EveryMementoRestoresItsState)
+{
+    std::mt19937 rnd{665};
+    Document doc{"The quick brown fox jumps over the lazy dog"};
+
+    std::vector<std::pair<Document::Memento, std::string>> mementos;
+
+    for (int i = 0; i < 500; ++i)
+    {
+        const size_t pos = std::uniform_int_distribution<size_t>{0, doc.length()}(rnd);
+
+        if (i % 3 == 0)
+            doc.erase(pos, 3);
+        else
+            doc.replace(pos, 2, std::string(i % 5, static_cast<char>('a' + i % 26)));
+
+        mementos.emplace_back(doc.create_shared_memento(), doc.text());
+
+        if (i % 50 == 0) // go back and branch
+            doc.set_memento(mementos[std::uniform_int_distribution<size_t>{0, mementos.size() - 1}(rnd)].first);
+    }
+
+    std::shuffle(mementos.begin(), mementos.end(), rnd);
+
+    for (auto& [memento, text] : mementos)
+    {
+        doc.set_memento(memento);
+        ASSERT_EQ(doc.text(), text);
+    }
+}
+
+//////////////////////////////////////////////////////////
+
+TEST(Document_Lines, ConvertsBetweenOffsetsAndPositions)
+{
+    Document doc{"first\nsecond\n"};
+    doc.add_text("third");
+
+    ASSERT_EQ(doc.line_count(), 3u);
+    ASSERT_EQ(doc.position_of(8), (TextPosition{1, 2}));
+    ASSERT_EQ(doc.offset_of(TextPosition{2, 5}), doc.length());
+    ASSERT_THAT(doc.line(1), StrEq("second"));
+    ASSERT_THAT(doc.line(2), StrEq("third"));
+}
+
+TEST(Document_Lines, ColumnOutOfLineThrows)
+{
+    Document doc{"ab\ncd"};
+
+    ASSERT_THROW(doc.offset_of(TextPosition{0, 3}), std::out_of_range);
+}
+
+TEST(Document_Lines, AreRestoredWithMemento)
+{
+    Document doc{"a\nb"};
+    auto memento = doc.create_shared_memento();
+
+    doc.insert(1, "\n\n");
+    ASSERT_EQ(doc.line_count(), 4u);
+
+    doc.set_memento(memento);
+    ASSERT_EQ(doc.line_count(), 2u);
+}
@@ -0,0 +1,133 @@
+#include <string>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "history.hpp"
+
+using namespace ::testing;
+
+struct HistoryTests : Test
+{
+    Document doc{"abc"};
+    History history{doc};
+
+    void edit(const std::string& text)
+    {
+        history.record([&] { doc.add_text(text); });
+    }
+};
+
+TEST_F(HistoryTests, NothingToUndoOrRedoAtStart)
+{
+    ASSERT_FALSE(history.undo());
+    ASSERT_FALSE(history.redo());
+    ASSERT_THAT(doc.text(), StrEq("abc"));
+}
+
+TEST_F(HistoryTests, UndoRestoresStateBeforeEdit)
+{
+    edit("1");
+    edit("2");
+
+    ASSERT_TRUE(history.undo());
+    ASSERT_THAT(doc.text(), StrEq("abc1"));
+    ASSERT_TRUE(history.undo());
+    ASSERT_THAT(doc.text(), StrEq("abc"));
+    ASSERT_FALSE(history.undo());
+}
+
+TEST_F(HistoryTests, RedoRestoresUndoneEdit)
+{
+    edit("1");
+    edit("2");
+    history.undo();
+    history.undo();
+
+    ASSERT_TRUE(history.redo());
+    ASSERT_THAT(doc.text(), StrEq("abc1"));
+    ASSERT_TRUE(history.redo());
+    ASSERT_THAT(doc.text(), StrEq("abc12"));
+    ASSERT_FALSE(history.redo());
+}
+
+TEST_F(HistoryTests, NewEditDiscardsRedo)
+{
+    edit("1");
+    history.undo();
+    edit("2");
+
+    ASSERT_EQ(history.redo_count(), 0);
+    ASSERT_FALSE(history.redo());
+    ASSERT_THAT(doc.text(), StrEq("abc2"));
+}
+
+TEST_F(HistoryTests, ThousandsOfStepsCanBeUndoneAndRedone)
+{
+    for (int i = 0; i < 5'000; ++i)
+        edit(std::to_string(i % 10));
+
+    while (history.undo())
+        ;
+
+    ASSERT_THAT(doc.text(), StrEq("abc"));
+
+    while (history.redo())
+        ;
+
+    ASSERT_EQ(doc.length(), 5'003);
+}
+
+TEST(History_MemoryBudget, OldestStepsAreEvictedWhenBudgetIsExceeded)
+{
+    Document doc;
+    History history{doc, 10'000};
+
+    for (int i = 0; i < 1'000; ++i)
+    {
+        history.record([&] { doc.add_text(std::string(100, 'x')); });
+    }
+
+    ASSERT_LE(history.memory_usage(), 10'000);
+    ASSERT_GT(history.undo_count(), 0);
+    ASSERT_LT(history.undo_count(), 1'000);
+
+    while (history.undo())
+        ;
+
+    ASSERT_EQ(doc.length(), 100 * (1'000 - history.redo_count()));
+}
+
+TEST_F(HistoryTests, NoStepIsRecordedWhenDocumentIsNotChanged)
+{
+    history.record([&] { doc.add_text(""); });
+    history.record([&] { doc.erase(1, 0); });
+
+    ASSERT_EQ(history.undo_count(), 0);
+}
+
+TEST(History_MemoryBudget, StepsAreChargedForTextTheyKeepAlive)
+{
+    Document doc{std::string(100'000, 'x')};
+    History history{doc, 20'000};
+
+    for (int i = 0; i < 50; ++i)
+    {
+        history.record([&] { doc.erase(0, 1'000); });
+        ASSERT_LE(history.memory_usage(), 20'000);
+    }
+
+    ASSERT_GT(history.undo_count(), 0);
+    ASSERT_LT(history.undo_count(), 20);
+
+    const size_t undone = history.undo_count();
+    while (history.undo())
+        ;
+
+    ASSERT_EQ(doc.length(), 100'000 - 1'000 * (50 - undone));
+
+    while (history.redo())
+        ;
+
+    ASSERT_EQ(doc.length(), 50'000);
+}
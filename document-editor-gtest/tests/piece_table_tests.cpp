@@ -0,0 +1,395 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "piece_table.hpp"
+
+using namespace ::testing;
+
+TEST(PieceTable_DefaultConstructed, IsEmpty)
+{
+    PieceTable text;
+
+    ASSERT_TRUE(text.empty());
+    ASSERT_THAT(text.text(), StrEq(""));
+}
+
+TEST(PieceTable_Insert, InsertsTextAtPosition)
+{
+    PieceTable text{"abcdef"};
+
+    text.insert(3, "123");
+    text.insert(0, "<");
+    text.insert(text.size(), ">");
+
+    ASSERT_THAT(text.text(), StrEq("<abc123def>"));
+}
+
+TEST(PieceTable_Insert, PositionOutOfTextThrows)
+{
+    PieceTable text{"abc"};
+
+    ASSERT_THROW(text.insert(4, "x"), std::out_of_range);
+}
+
+TEST(PieceTable_Insert, TypedTextExtendsTheLastPiece)
+{
+    PieceTable text{"abc"};
+
+    for (char c : std::string{"defgh"})
+        text.insert(text.size(), std::string(1, c));
+
+    ASSERT_THAT(text.text(), StrEq("abcdefgh"));
+    ASSERT_EQ(text.pieces_count(), 2);
+}
+
+TEST(PieceTable_Erase, ErasesTextFromManyPieces)
+{
+    PieceTable text{"abcdef"};
+    text.insert(3, "123");
+
+    text.erase(2, 5);
+
+    ASSERT_THAT(text.text(), StrEq("abef"));
+}
+
+TEST(PieceTable_Erase, CountIsLimitedToTheEndOfText)
+{
+    PieceTable text{"abcdef"};
+
+    text.erase(4, 100);
+
+    ASSERT_THAT(text.text(), StrEq("abcd"));
+}
+
+TEST(PieceTable_Replace, ReplacesText)
+{
+    PieceTable text{"abcdef"};
+
+    text.replace(1, 4, "XY");
+
+    ASSERT_THAT(text.text(), StrEq("aXYf"));
+}
+
+TEST(PieceTable_Copy, CopiesAreIndependent)
+{
+    PieceTable text{"abc"};
+    text.insert(3, "def");
+
+    PieceTable copy = text;
+    copy.insert(6, "ghi");
+    text.insert(6, "123");
+    copy.erase(0, 1);
+
+    ASSERT_THAT(text.text(), StrEq("abcdef123"));
+    ASSERT_THAT(copy.text(), StrEq("bcdefghi"));
+}
+
+TEST(PieceTable_Chunks, ChunksMakeTheWholeText)
+{
+    PieceTable text{"abcdef"};
+    text.insert(3, "123");
+
+    std::vector<std::string> chunks;
+    text.for_each_chunk([&](std::string_view chunk) { chunks.emplace_back(chunk); });
+
+    ASSERT_THAT(chunks, ElementsAre("abc", "123", "def"));
+}
+
+TEST(PieceTable_Chunks, IteratorVisitsChunksInOrder)
+{
+    PieceTable text{"abcdef"};
+    text.insert(3, "123");
+    text.insert(0, "<");
+
+    std::vector<std::string> chunks(text.chunks().begin(), text.chunks().end());
+
+    ASSERT_THAT(chunks, ElementsAre("<", "abc", "123", "def"));
+}
+
+TEST(PieceTable_Chunks, EmptyTextHasNoChunks)
+{
+    PieceTable text;
+
+    ASSERT_EQ(text.chunks().begin(), text.chunks().end());
+}
+
+TEST(PieceTable_ContiguousView, IsAvailableForTextInOnePiece)
+{
+    PieceTable text{"abcdef"};
+
+    ASSERT_EQ(text.contiguous_view(), "abcdef");
+
+    text.insert(3, "123");
+
+    ASSERT_EQ(text.contiguous_view(), std::nullopt);
+}
+
+TEST(PieceTable_ReplaceAll, ReplacesRangesAcrossPieces)
+{
+    const std::string part(1000, 'a');
+    PieceTable text{part + "xyz" + part};
+    text.insert(1001, "123");
+
+    const std::vector<TextRange> ranges{{998, 4}, {1003, 3}, {2006, 0}};
+    text.replace_all(ranges, "_");
+
+    ASSERT_EQ(text.text(), std::string(998, 'a') + "_2_" + part + "_");
+    ASSERT_EQ(text.pieces_count(), 6u);
+}
+
+TEST(PieceTable_ReplaceAll, SharesTheReplacementBetweenPieces)
+{
+    const std::string part(1000, 'a');
+    PieceTable text{part + "." + part + "." + part};
+
+    const std::vector<TextRange> ranges{{1000, 1}, {2001, 1}};
+    text.replace_all(ranges, "--");
+
+    ASSERT_EQ(text.text(), part + "--" + part + "--" + part);
+    ASSERT_EQ(text.pieces_count(), 5u);
+}
+
+TEST(PieceTable_ReplaceAll, DenseReplacementsAreCopiedIntoOnePiece)
+{
+    PieceTable text{"a.b.c.d"};
+
+    const std::vector<TextRange> ranges{{1, 1}, {3, 1}, {5, 1}};
+    text.replace_all(ranges, "--");
+
+    ASSERT_THAT(text.text(), StrEq("a--b--c--d"));
+    ASSERT_EQ(text.pieces_count(), 1u);
+}
+
+TEST(PieceTable_ReplaceAll, OverlappingOrOutOfTextRangesThrow)
+{
+    PieceTable text{"abcdef"};
+
+    const std::vector<TextRange> overlapping{{0, 3}, {2, 1}};
+    const std::vector<TextRange> out_of_text{{4, 3}};
+
+    ASSERT_THROW(text.replace_all(overlapping, "x"), std::invalid_argument);
+    ASSERT_THROW(text.replace_all(out_of_text, "x"), std::out_of_range);
+    ASSERT_THAT(text.text(), StrEq("abcdef"));
+}
+
+TEST(PieceTable_RandomEdits, MatchesString)
+{
+    std::mt19937 rnd{42};
+    std::string expected = "The quick brown fox jumps over the lazy dog";
+    PieceTable text{expected};
+
+    for (int i = 0; i < 5'000; ++i)
+    {
+        const size_t pos = std::uniform_int_distribution<size_t>{0, expected.size()}(rnd);
+        const size_t count = std::uniform_int_distribution<size_t>{0, 8}(rnd);
+        const std::string inserted(std::uniform_int_distribution<size_t>{0, 6}(rnd), static_cast<char>('a' + i % 26));
+
+        expected.replace(pos, count, inserted);
+        text.replace(pos, count, inserted);
+
+        ASSERT_EQ(text.size(), expected.size());
+    }
+
+    ASSERT_EQ(text.text(), expected);
+}
+
+//////////////////////////////////////////////////////////
+
+TEST(PieceTable_Lines, TextWithoutLineBreaksIsOneLine)
+{
+    PieceTable text{"abc"};
+
+    ASSERT_EQ(text.line_count(), 1u);
+    ASSERT_EQ(text.line_range(0), (TextRange{0, 3}));
+}
+
+TEST(PieceTable_Lines, LinesAreFoundAcrossPieces)
+{
+    PieceTable text{"line1\nline3\n"};
+    text.insert(6, "line2\n");
+
+    ASSERT_EQ(text.line_count(), 4u);
+    ASSERT_EQ(text.line_start(1), 6u);
+    ASSERT_EQ(text.line_start(2), 12u);
+    ASSERT_EQ(text.line_range(3), (TextRange{18, 0}));
+    ASSERT_EQ(text.line_of(13), 2u);
+    ASSERT_EQ(text.line_of(text.size()), 3u);
+}
+
+TEST(PieceTable_Lines, LineOutOfTextThrows)
+{
+    PieceTable text{"a\nb"};
+
+    ASSERT_THROW(text.line_start(2), std::out_of_range);
+}
+
+TEST(PieceTable_Lines, RandomEditsKeepLineIndex)
+{
+    std::mt19937 rnd{7};
+    std::string expected = "first\nsecond\n\nfourth";
+    PieceTable text{expected};
+
+    for (int i = 0; i < 2'000; ++i)
+    {
+        const size_t pos = std::uniform_int_distribution<size_t>{0, expected.size()}(rnd);
+        const size_t count = std::uniform_int_distribution<size_t>{0, 8}(rnd);
+        std::string inserted(std::uniform_int_distribution<size_t>{0, 6}(rnd), 'x');
+        for (auto& c : inserted)
+            c = std::uniform_int_distribution<int>{0, 3}(rnd) == 0 ? '\n' : 'x';
+
+        expected.replace(pos, count, inserted);
+        text.replace(pos, count, inserted);
+
+        const size_t probe = std::uniform_int_distribution<size_t>{0, expected.size()}(rnd);
+        const size_t line = std::count(expected.begin(), expected.begin() + probe, '\n');
+
+        ASSERT_EQ(text.line_count(), std::count(expected.begin(), expected.end(), '\n') + 1u);
+        ASSERT_EQ(text.line_of(probe), line);
+        ASSERT_EQ(text.line_start(line), line == 0 ? 0 : expected.rfind('\n', probe - 1) + 1);
+    }
+}
+
+TEST(PieceTable_Lines, LinesAreFoundAcrossBlocksOfLineIndex)
+{
+    std::mt19937 rnd{11};
+    std::string expected(5 * LineIndex::block_size + 123, 'x');
+    for (auto& c : expected)
+        c = std::uniform_int_distribution<int>{0, 40}(rnd) == 0 ? '\n' : 'x';
+
+    PieceTable text{expected};
+    text.insert(2 * LineIndex::block_size - 7, "a\nb");
+    expected.insert(2 * LineIndex::block_size - 7, "a\nb");
+
+    ASSERT_EQ(text.line_count(), std::count(expected.begin(), expected.end(), '\n') + 1u);
+
+    for (int i = 0; i < 200; ++i)
+    {
+        const size_t probe = std::uniform_int_distribution<size_t>{0, expected.size()}(rnd);
+        const size_t line = std::count(expected.begin(), expected.begin() + probe, '\n');
+
+        ASSERT_EQ(text.line_of(probe), line);
+        ASSERT_EQ(text.line_start(line), line == 0 ? 0 : expected.rfind('\n', probe - 1) + 1);
+    }
+}
+
+TEST(PieceTable_Lines, LinesAreFoundAfterBlocksWithoutLineBreaks)
+{
+    const std::string long_line(3 * LineIndex::block_size + 10, 'x');
+    PieceTable text{"a\n" + long_line + "\nb\nc"};
+
+    ASSERT_EQ(text.line_count(), 4u);
+    ASSERT_EQ(text.line_range(1), (TextRange{2, long_line.size()}));
+    ASSERT_EQ(text.line_start(3), long_line.size() + 5);
+    ASSERT_EQ(text.line_of(long_line.size() + 4), 2u);
+}
+
+TEST(PieceTable_Lines, CopiesCanBeReadConcurrently)
+{
+    std::string expected;
+    for (int i = 0; i < 50'000; ++i)
+        expected += "line " + std::to_string(i) + "\n";
+
+    PieceTable text{expected};
+    text.insert(expected.size() / 2, "x\ny");
+    const PieceTable copy = text;
+
+    std::vector<size_t> counts(4);
+    {
+        std::vector<std::jthread> readers;
+        for (size_t i = 0; i < counts.size(); ++i)
+        {
+            readers.emplace_back([&, i] {
+                const PieceTable& table = i % 2 == 0 ? text : copy;
+                counts[i] = table.line_count();
+                table.line_start(counts[i] - 1);
+            });
+        }
+    }
+
+    ASSERT_THAT(counts, Each(50'002u));
+}
+
+//////////////////////////////////////////////////////////
+
+TEST(PieceTable_BytesNotSharedWith, CopyIsShared)
+{
+    PieceTable text{"abc"};
+    text.insert(1, "123");
+    PieceTable copy = text;
+
+    ASSERT_EQ(copy.bytes_not_shared_with(text), 0u);
+}
+
+TEST(PieceTable_BytesNotSharedWith, CountsTextRemovedFromTheOther)
+{
+    PieceTable text{std::string(10'000, 'x')};
+    PieceTable edited = text;
+    edited.erase(100, 1'000);
+
+    ASSERT_GE(text.bytes_not_shared_with(edited), 1'000u);
+    ASSERT_LT(text.bytes_not_shared_with(edited), 1'000u + 4 * PieceTable::bytes_per_piece);
+    ASSERT_LT(edited.bytes_not_shared_with(text), 4 * PieceTable::bytes_per_piece);
+}
+
+TEST(PieceTable_BytesNotSharedWith, SharedPartsOfASplitPieceAreSkipped)
+{
+    // the parts of the split piece get the same priority
+    std::mt19937 rnd{5};
+    PieceTable text{std::string(100'000, 'x')};
+
+    for (int i = 0; i < 1'000; ++i)
+        text.erase(std::uniform_int_distribution<size_t>{0, text.size() - 1}(rnd), 1);
+
+    for (int i = 0; i < 20; ++i)
+    {
+        PieceTable edited = text;
+        edited.erase(std::uniform_int_distribution<size_t>{0, text.size() - 1}(rnd), 1);
+
+        // the edited copy has the replaced nodes and the new part
+        ASSERT_LT(text.bytes_not_shared_with(edited), edited.bytes_not_shared_with(text) + PieceTable::bytes_per_piece);
+    }
+}
+
+TEST(PieceTable_Compact, KeepsTextAndSharingOfTables)
+{
+    std::mt19937 rnd{3};
+    PieceTable text{"first line\nsecond line"};
+    std::vector<PieceTable> versions;
+
+    for (int i = 0; i < 200; ++i)
+    {
+        const size_t pos = std::uniform_int_distribution<size_t>{0, text.size()}(rnd);
+        text.replace(pos, std::min<size_t>(3, text.size() - pos), i % 4 == 0 ? "\n" : std::to_string(i));
+
+        if (i % 40 == 0)
+            versions.push_back(text);
+    }
+
+    std::vector<std::string> expected;
+    std::vector<PieceTable*> tables{&text};
+    for (auto& version : versions)
+    {
+        expected.push_back(version.text());
+        tables.push_back(&version);
+    }
+    expected.push_back(text.text());
+
+    const size_t not_shared = versions.front().bytes_not_shared_with(versions.back());
+
+    PieceTable::compact(tables);
+
+    for (size_t i = 0; i < versions.size(); ++i)
+        ASSERT_EQ(versions[i].text(), expected[i]);
+    ASSERT_EQ(text.text(), expected.back());
+    ASSERT_EQ(text.line_count(), std::count(expected.back().begin(), expected.back().end(), '\n') + 1u);
+    ASSERT_EQ(versions.front().bytes_not_shared_with(versions.back()), not_shared);
+
+    text.insert(0, "typed");
+    ASSERT_EQ(text.text(), "typed" + expected.back());
+}
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "text_search.hpp"
+
+using namespace ::testing;
+
+namespace
+{
+    std::vector<TextRange> naive_find_all(const std::string& text, const std::string& pattern)
+    {
+        std::vector<TextRange> matches;
+
+        for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + pattern.size()))
+            matches.push_back(TextRange{pos, pattern.size()});
+
+        return matches;
+    }
+
+    // the same text split into many pieces by inserting it in random order
+    Document fragmented(const std::string& text, std::mt19937& rnd)
+    {
+        Document doc;
+        std::vector<size_t> cuts{0, text.size()};
+
+        for (int i = 0; i < 40; ++i)
+            cuts.push_back(std::uniform_int_distribution<size_t>{0, text.size()}(rnd));
+
+        std::sort(cuts.begin(), cuts.end());
+        cuts.erase(std::unique(cuts.begin(), cuts.end()), cuts.end());
+
+        for (size_t i = cuts.size() - 1; i > 0; --i)
+            doc.insert(0, std::string_view{text}.substr(cuts[i - 1], cuts[i] - cuts[i - 1]));
+
+        return doc;
+    }
+} // namespace
+
+TEST(TextSearch_FindAll, FindsAllOccurrences)
+{
+    Document doc{"one two one three one"};
+
+    ASSERT_THAT(TextSearch::find_all(doc, "one"), ElementsAre(TextRange{0, 3}, TextRange{8, 3}, TextRange{18, 3}));
+}
+
+TEST(TextSearch_FindAll, MatchesDoNotOverlap)
+{
+    Document doc{"aaaaa"};
+
+    ASSERT_THAT(TextSearch::find_all(doc, "aa"), ElementsAre(TextRange{0, 2}, TextRange{2, 2}));
+}
+
+TEST(TextSearch_FindAll, FindsMatchesAcrossPieces)
+{
+    Document doc{"hello"};
+    doc.add_text(" wor");
+    doc.insert(0, ">");
+    doc.add_text("ld");
+
+    ASSERT_GT(std::distance(doc.chunks().begin(), doc.chunks().end()), 1);
+    ASSERT_THAT(TextSearch::find_all(doc, "o wo"), ElementsAre(TextRange{5, 4}));
+}
+
+TEST(TextSearch_FindAll, EmptyPatternThrows)
+{
+    Document doc{"abc"};
+
+    ASSERT_THROW(TextSearch::find_all(doc, ""), std::invalid_argument);
+}
+
+TEST(TextSearch_FindAll, MatchesNaiveSearchInFragmentedDocuments)
+{
+    std::mt19937 rnd{42};
+    const std::vector<std::string> patterns{"a", "ab", "aba", "abcab", "bbbbbbbbbbbbbbbbbbbbb", "cabacabacab"};
+
+    for (int i = 0; i < 50; ++i)
+    {
+        std::string text(std::uniform_int_distribution<size_t>{0, 300}(rnd), ' ');
+        for (auto& c : text)
+            c = "abc"[std::uniform_int_distribution<int>{0, 2}(rnd)];
+
+        const Document doc = fragmented(text, rnd);
+        ASSERT_EQ(doc.text(), text);
+
+        for (const auto& pattern : patterns)
+            ASSERT_EQ(TextSearch::find_all(doc, pattern), naive_find_all(text, pattern)) << text << " / " << pattern;
+    }
+}
+
+TEST(TextSearch_FindAll, FindsRegexMatches)
+{
+    Document doc{"x=1, y=22"};
+    doc.add_text(", z=333");
+
+    ASSERT_THAT(TextSearch::find_all(doc, std::regex{"[0-9]+"}), ElementsAre(TextRange{2, 1}, TextRange{7, 2}, TextRange{13, 3}));
+}
+
+//////////////////////////////////////////////////////////
+
+TEST(TextSearch_ReplaceAll, ReplacesAllOccurrences)
+{
+    Document doc{"one two one three one"};
+
+    ASSERT_EQ(TextSearch::replace_all(doc, "one", "1"), 3u);
+    ASSERT_THAT(doc.text(), StrEq("1 two 1 three 1"));
+}
+
+TEST(TextSearch_ReplaceAll, ReplacesRegexMatches)
+{
+    Document doc{"x=1, y=22"};
+
+    ASSERT_EQ(TextSearch::replace_all(doc, std::regex{"[0-9]+"}, "N"), 2u);
+    ASSERT_THAT(doc.text(), StrEq("x=N, y=N"));
+}
+
+TEST(TextSearch_ReplaceAll, IsASingleChangeOfTheDocument)
+{
+    Document doc{"a-b-c-d"};
+    auto memento = doc.create_shared_memento();
+
+    TextSearch::replace_all(doc, "-", "+");
+    ASSERT_THAT(doc.text(), StrEq("a+b+c+d"));
+
+    doc.set_memento(memento);
+    ASSERT_THAT(doc.text(), StrEq("a-b-c-d"));
+}
+
+TEST(TextSearch_ReplaceAll, MatchesNaiveReplaceInFragmentedDocuments)
+{
+    std::mt19937 rnd{7};
+
+    for (int i = 0; i < 50; ++i)
+    {
+        std::string text(std::uniform_int_distribution<size_t>{0, 200}(rnd), ' ');
+        for (auto& c : text)
+            c = "ab"[std::uniform_int_distribution<int>{0, 1}(rnd)];
+
+        Document doc = fragmented(text, rnd);
+        TextSearch::replace_all(doc, "ab", "<X>");
+
+        std::string expected = std::regex_replace(text, std::regex{"ab"}, "<X>");
+        ASSERT_EQ(doc.text(), expected) << text;
+    }
+}
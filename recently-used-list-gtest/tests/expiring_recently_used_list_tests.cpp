@@ -0,0 +1,144 @@
+#include <chrono>
+
+#include "expiring_recently_used_list.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+using namespace std::chrono_literals;
+
+struct FakeClock
+{
+    using rep = std::chrono::milliseconds::rep;
+    using period = std::chrono::milliseconds::period;
+    using duration = std::chrono::milliseconds;
+    using time_point = std::chrono::time_point<FakeClock>;
+    constexpr static bool is_steady = true;
+
+    static inline time_point current{};
+
+    static time_point now()
+    {
+        return current;
+    }
+
+    static void advance(duration elapsed)
+    {
+        current += elapsed;
+    }
+};
+
+struct ExpiringRecentlyUsedListTests : Test
+{
+    ExpiringRecentlyUsedList<FakeClock> rul{100ms};
+
+    void SetUp() override
+    {
+        FakeClock::current = FakeClock::time_point{};
+    }
+};
+
+TEST_F(ExpiringRecentlyUsedListTests, DefaultConstructed_IsEmpty)
+{
+    ASSERT_THAT(rul, IsEmpty());
+    ASSERT_THAT(rul.time_to_live(), Eq(100ms));
+}
+
+TEST_F(ExpiringRecentlyUsedListTests, AddingEmptyStringThrowsAnException)
+{
+    ASSERT_THROW(rul.add(""), std::invalid_argument);
+}
+
+TEST_F(ExpiringRecentlyUsedListTests, ItemsAreInRecentlyUsedOrder)
+{
+    rul.add("item1");
+    rul.add("item2");
+    rul.add("item3");
+    rul.add("item2");
+
+    ASSERT_THAT(rul, ElementsAre("item2", "item3", "item1"));
+    ASSERT_THAT(rul.front(), Eq("item2"));
+    ASSERT_THAT(rul.back(), Eq("item1"));
+}
+
+TEST_F(ExpiringRecentlyUsedListTests, ItemExpiresAfterTimeToLive)
+{
+    rul.add("item1");
+    FakeClock::advance(60ms);
+    rul.add("item2");
+
+    FakeClock::advance(40ms);
+
+    ASSERT_THAT(rul, ElementsAre("item2"));
+    ASSERT_FALSE(rul.contains("item1"));
+    ASSERT_TRUE(rul.contains("item2"));
+}
+
+TEST_F(ExpiringRecentlyUsedListTests, AddingDuplicateRefreshesItsTimestamp)
+{
+    rul.add("item1");
+    rul.add("item2");
+    FakeClock::advance(60ms);
+
+    rul.add("item1");
+    FakeClock::advance(60ms);
+
+    ASSERT_THAT(rul, ElementsAre("item1"));
+}
+
+TEST_F(ExpiringRecentlyUsedListTests, ExpiredItemCanBeAddedAgain)
+{
+    rul.add("item1");
+    rul.add("item2");
+    FakeClock::advance(100ms);
+
+    rul.add("item1");
+
+    ASSERT_THAT(rul, ElementsAre("item1"));
+    ASSERT_THAT(rul.size(), Eq(1u));
+}
+
+TEST_F(ExpiringRecentlyUsedListTests, ClearRemovesAllItems)
+{
+    rul.add("item1");
+
+    rul.clear();
+
+    ASSERT_THAT(rul, IsEmpty());
+    ASSERT_FALSE(rul.contains("item1"));
+}
+
+TEST_F(ExpiringRecentlyUsedListTests, CopyIsIndependentOfTheOriginal)
+{
+    rul.add("item1");
+    rul.add("item2");
+
+    ExpiringRecentlyUsedList<FakeClock> copy{rul};
+    ExpiringRecentlyUsedList<FakeClock> assigned{10ms};
+    assigned.add("other");
+    assigned = rul;
+
+    rul.clear();
+    copy.add("item1");
+    assigned.add("item3");
+
+    ASSERT_THAT(copy, ElementsAre("item1", "item2"));
+    ASSERT_TRUE(copy.contains("item2"));
+    ASSERT_THAT(assigned, ElementsAre("item3", "item2", "item1"));
+    ASSERT_EQ(assigned.time_to_live(), 100ms);
+    ASSERT_FALSE(assigned.contains("other"));
+}
+
+TEST(ExpiringRecentlyUsedList_BoundedCapacity, WhenListIsFullAddingUniqueItemDropsItemAtBack)
+{
+    FakeClock::current = FakeClock::time_point{};
+    ExpiringRecentlyUsedList<FakeClock> rul{1s, 3};
+
+    rul.add("item1");
+    rul.add("item2");
+    rul.add("item3");
+    rul.add("item4");
+
+    ASSERT_THAT(rul, ElementsAre("item4", "item3", "item2"));
+    ASSERT_FALSE(rul.contains("item1"));
+}
@@ -0,0 +1,118 @@
+#include <string>
+#include <vector>
+
+#include "fixed_recently_used_list.hpp"
+#include "recently_used_list.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+
+TEST(FixedRecentlyUsedList_DefaultConstructed, IsEmpty)
+{
+    FixedRecentlyUsedList<8> rul;
+
+    ASSERT_THAT(rul, IsEmpty());
+    ASSERT_THAT(rul.size(), Eq(0u));
+}
+
+TEST(FixedRecentlyUsedList_DefaultConstructed, CapacityIsSetAtCompileTime)
+{
+    static_assert(FixedRecentlyUsedList<16>::capacity() == 16);
+
+    ASSERT_THAT(FixedRecentlyUsedList<5>::capacity(), Eq(5u));
+}
+
+TEST(FixedRecentlyUsedList_AddingItem, LastAddedItemIsAtFront)
+{
+    FixedRecentlyUsedList<8> rul;
+
+    rul.add("item1");
+    rul.add("item2");
+
+    ASSERT_THAT(rul.front(), Eq("item2"));
+    ASSERT_THAT(rul, ElementsAre("item2", "item1"));
+}
+
+TEST(FixedRecentlyUsedList_AddingItem, AddingEmptyStringThrowsAnException)
+{
+    FixedRecentlyUsedList<8> rul;
+
+    ASSERT_THROW(rul.add(""), std::invalid_argument);
+}
+
+TEST(FixedRecentlyUsedList_AddingItem, AddingTooLongItemThrowsAnException)
+{
+    FixedRecentlyUsedList<8, 4> rul;
+
+    rul.add("1234");
+
+    ASSERT_THROW(rul.add("12345"), std::length_error);
+    ASSERT_THAT(rul, ElementsAre("1234"));
+}
+
+struct FixedRecentlyUsedList_WithItems : Test
+{
+    FixedRecentlyUsedList<5> rul;
+
+    void SetUp() override
+    {
+        rul.add("item1");
+        rul.add("item2");
+        rul.add("item3");
+    }
+};
+
+TEST_F(FixedRecentlyUsedList_WithItems, ItemsCanBeLookedUpByIndex)
+{
+    ASSERT_THAT(rul[0], Eq("item3"));
+    ASSERT_THAT(rul[1], Eq("item2"));
+    ASSERT_THAT(rul[2], Eq("item1"));
+    ASSERT_THAT(rul.back(), Eq("item1"));
+}
+
+TEST_F(FixedRecentlyUsedList_WithItems, InsertingDuplicateMovesItToFront)
+{
+    rul.add("item2");
+
+    ASSERT_THAT(rul, ElementsAre("item2", "item3", "item1"));
+}
+
+TEST_F(FixedRecentlyUsedList_WithItems, WhenListIsFullAddingUniqueItemDropsItemAtBack)
+{
+    rul.add("item4");
+    rul.add("item5");
+
+    rul.add("item6");
+    rul.add("item7");
+
+    ASSERT_THAT(rul, ElementsAre("item7", "item6", "item5", "item4", "item3"));
+}
+
+TEST_F(FixedRecentlyUsedList_WithItems, ClearRemovesAllItems)
+{
+    rul.clear();
+
+    ASSERT_THAT(rul, IsEmpty());
+
+    rul.add("item1");
+    ASSERT_THAT(rul, ElementsAre("item1"));
+}
+
+TEST(FixedRecentlyUsedList_Equivalence, BehavesLikeRecentlyUsedList)
+{
+    FixedRecentlyUsedList<13> fixed_rul;
+    RecentlyUsedList rul(13);
+
+    unsigned int seed = 42;
+    for (int i = 0; i < 2000; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        auto item = "item" + std::to_string((seed >> 16) % 29);
+
+        fixed_rul.add(item);
+        rul.add(item);
+
+        ASSERT_TRUE(std::equal(fixed_rul.begin(), fixed_rul.end(), rul.begin(), rul.end())) << "after adding " << item;
+    }
+}
@@ -0,0 +1,137 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "recently_used_list_snapshot.hpp"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using namespace ::testing;
+
+struct RecentlyUsedListSnapshot_Saved : Test
+{
+    RecentlyUsedList rul{5};
+    std::stringstream stream;
+
+    void SetUp() override
+    {
+        rul.add("item1");
+        rul.add("item2");
+        rul.add("item3");
+        rul.add("item1");
+
+        RecentlyUsedListSnapshot::save(rul, stream);
+    }
+};
+
+TEST_F(RecentlyUsedListSnapshot_Saved, LoadRestoresItemsInOrder)
+{
+    auto restored = RecentlyUsedListSnapshot::load(stream);
+
+    ASSERT_THAT(restored, ElementsAre("item1", "item3", "item2"));
+}
+
+TEST_F(RecentlyUsedListSnapshot_Saved, LoadRestoresCapacity)
+{
+    auto restored = RecentlyUsedListSnapshot::load(stream);
+
+    ASSERT_THAT(restored.capacity(), Eq(5u));
+}
+
+TEST_F(RecentlyUsedListSnapshot_Saved, RestoredListBehavesLikeTheOriginal)
+{
+    auto restored = RecentlyUsedListSnapshot::load(stream.str());
+
+    restored.add("item2");
+    restored.add("item4");
+    restored.add("item5");
+    restored.add("item6");
+
+    ASSERT_THAT(restored, ElementsAre("item6", "item5", "item4", "item2", "item1"));
+}
+
+TEST_F(RecentlyUsedListSnapshot_Saved, TruncatedSnapshotThrowsAnException)
+{
+    auto data = stream.str();
+    data.pop_back();
+
+    ASSERT_THROW(RecentlyUsedListSnapshot::load(data), std::runtime_error);
+}
+
+TEST(RecentlyUsedListSnapshot_Load, InvalidHeaderThrowsAnException)
+{
+    ASSERT_THROW(RecentlyUsedListSnapshot::load(std::string_view{"RULX\1\0\0\0"}), std::runtime_error);
+}
+
+TEST(RecentlyUsedListSnapshot_LoadFile, RestoresListFromFile)
+{
+    auto path = std::filesystem::temp_directory_path() / "rul_snapshot_test.bin";
+
+    RecentlyUsedList rul;
+    for (int i = 0; i < 10'000; ++i)
+        rul.add("item" + std::to_string(i));
+
+    {
+        std::ofstream out{path, std::ios::binary};
+        RecentlyUsedListSnapshot::save(rul, out);
+    }
+
+    auto restored = RecentlyUsedListSnapshot::load_file(path.string());
+    std::filesystem::remove(path);
+
+    ASSERT_THAT(restored.size(), Eq(10'000u));
+    ASSERT_TRUE(std::equal(rul.begin(), rul.end(), restored.begin(), restored.end()));
+}
+
+TEST(RecentlyUsedListJournal_Replay, AppliesAddsInOrder)
+{
+    std::stringstream log;
+    RecentlyUsedList rul(3);
+    RecentlyUsedListJournal journal{log};
+
+    for (auto item : {"item1", "item2", "item3", "item1", "item4"})
+        journal.add(rul, item);
+
+    RecentlyUsedList replayed(3);
+    RecentlyUsedListJournal::replay(log, replayed);
+
+    ASSERT_THAT(replayed, ElementsAre("item4", "item1", "item3"));
+    ASSERT_TRUE(std::equal(rul.begin(), rul.end(), replayed.begin(), replayed.end()));
+}
+
+TEST(RecentlyUsedListJournal_Replay, StartsFromSnapshot)
+{
+    RecentlyUsedList rul;
+    rul.add("item1");
+    rul.add("item2");
+
+    std::stringstream snapshot;
+    RecentlyUsedListSnapshot::save(rul, snapshot);
+
+    std::stringstream log;
+    RecentlyUsedListJournal journal{log};
+    journal.add(rul, "item3");
+    journal.add(rul, "item1");
+
+    auto restored = RecentlyUsedListSnapshot::load(snapshot);
+    RecentlyUsedListJournal::replay(log, restored);
+
+    ASSERT_THAT(restored, ElementsAre("item1", "item3", "item2"));
+}
+
+TEST(RecentlyUsedListJournal_Replay, IgnoresTornRecordAtTheEnd)
+{
+    std::stringstream log;
+    RecentlyUsedList rul;
+    RecentlyUsedListJournal journal{log};
+    journal.add(rul, "item1");
+    journal.add(rul, "item2");
+
+    auto data = log.str();
+    data.resize(data.size() - 2);
+
+    RecentlyUsedList replayed;
+    RecentlyUsedListJournal::replay(std::string_view{data}, replayed);
+
+    ASSERT_THAT(replayed, ElementsAre("item1"));
+}
@@ -1,4 +1,8 @@
 #include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "recently_used_list.hpp"
 #include "gmock/gmock.h"
@@ -152,4 +156,97 @@ TEST(RecentlyUsedList_BoundedCapacity, WhenListIsFullAddingUniqueItemDropsItemAt
 
     // Assert
     ASSERT_THAT(rul, ElementsAre("item4", "item3", "item2"));
-}
\ No newline at end of file
+}
+
+struct RecentlyUsedList_AddRange : RecentlyUsedList_WithItems
+{
+};
+
+TEST_F(RecentlyUsedList_AddRange, GivesTheSameOrderAsSequentialAdds)
+{
+    std::vector<std::string> items = {"item4", "item1", "item5", "item4", "item2"};
+
+    RecentlyUsedList expected;
+    for (const auto& item : {"item1", "item2", "item3"})
+        expected.add(item);
+    for (const auto& item : items)
+        expected.add(item);
+
+    rul.add_range(items.begin(), items.end());
+
+    ASSERT_THAT(rul, ElementsAre("item2", "item4", "item5", "item1", "item3"));
+    ASSERT_TRUE(std::equal(rul.begin(), rul.end(), expected.begin(), expected.end()));
+}
+
+TEST_F(RecentlyUsedList_AddRange, AcceptsInputIterators)
+{
+    std::istringstream input{"item4 item1 item4"};
+
+    rul.add_range(std::istream_iterator<std::string>{input}, std::istream_iterator<std::string>{});
+
+    ASSERT_THAT(rul, ElementsAre("item4", "item1", "item3", "item2"));
+}
+
+TEST_F(RecentlyUsedList_AddRange, EmptyStringInRangeThrowsAndLeavesListUnchanged)
+{
+    const char* items[] = {"item4", "", "item5"};
+
+    ASSERT_THROW(rul.add_range(std::begin(items), std::end(items)), std::invalid_argument);
+    ASSERT_THAT(rul, ElementsAre("item3", "item2", "item1"));
+}
+
+TEST_F(RecentlyUsedList_AddRange, RangeOfTheListItselfReversesItsOrder)
+{
+    rul.add(std::string(100, 'x'));
+
+    rul.add_range(rul.begin(), rul.end());
+
+    ASSERT_THAT(rul, ElementsAre("item1", "item2", "item3", std::string(100, 'x')));
+}
+
+TEST(RecentlyUsedList_AddRangeWithBoundedCapacity, GivesTheSameOrderAsSequentialAdds)
+{
+    RecentlyUsedList rul(4);
+    RecentlyUsedList expected(4);
+
+    std::vector<std::string> items;
+    unsigned int seed = 7;
+    for (int i = 0; i < 200; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        items.push_back("item" + std::to_string((seed >> 16) % 10));
+    }
+
+    for (size_t first = 0; first < items.size(); first += 9)
+    {
+        auto last = std::min(first + 9, items.size());
+
+        rul.add_range(items.begin() + first, items.begin() + last);
+        std::for_each(items.begin() + first, items.begin() + last, [&](const auto& item) { expected.add(item); });
+
+        ASSERT_TRUE(std::equal(rul.begin(), rul.end(), expected.begin(), expected.end()));
+    }
+}
+
+struct RecentlyUsedList_Merge : RecentlyUsedList_WithItems
+{
+};
+
+TEST_F(RecentlyUsedList_Merge, ItemsOfOtherListAreMovedToFrontInTheirOrder)
+{
+    RecentlyUsedList local;
+    local.add("item5");
+    local.add("item1");
+    local.add("item4");
+
+    rul.merge(local);
+
+    ASSERT_THAT(rul, ElementsAre("item4", "item1", "item5", "item3", "item2"));
+}
+
+TEST_F(RecentlyUsedList_Merge, MergingListWithItselfChangesNothing)
+{
+    rul.merge(rul);
+
+    ASSERT_THAT(rul, ElementsAre("item3", "item2", "item1"));
+}
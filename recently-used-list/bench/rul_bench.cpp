@@ -0,0 +1,131 @@
+#include "fixed_recently_used_list.hpp"
+#include "recently_used_list.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace
+{
+    size_t sink = 0;
+
+    vector<string> make_keys(size_t count)
+    {
+        vector<string> keys;
+        keys.reserve(count);
+
+        for (size_t i = 0; i < count; ++i)
+            keys.push_back("key" + to_string(i));
+
+        return keys;
+    }
+
+    vector<size_t> make_indexes(size_t count, size_t bound)
+    {
+        mt19937_64 rnd{2024};
+        uniform_int_distribution<size_t> distribution{0, bound - 1};
+
+        vector<size_t> indexes(count);
+        generate(indexes.begin(), indexes.end(), [&] { return distribution(rnd); });
+
+        return indexes;
+    }
+
+    // operations with O(n) cost are repeated less often on large lists
+    size_t operation_count(size_t size)
+    {
+        return clamp<size_t>(20'000'000 / size, 50, 200'000);
+    }
+
+    template <typename Operation>
+    double ns_per_op(size_t ops, Operation operation)
+    {
+        auto start = chrono::steady_clock::now();
+
+        for (size_t i = 0; i < ops; ++i)
+            operation(i);
+
+        chrono::duration<double, nano> elapsed = chrono::steady_clock::now() - start;
+        return elapsed.count() / ops;
+    }
+
+    void report(const char* scenario, const char* list, size_t size, double ns)
+    {
+        printf("%-24s %-28s %10zu %14.1f\n", scenario, list, size, ns);
+    }
+
+    void fill(RecentlyUsedList& rul, const vector<string>& keys, size_t size)
+    {
+        rul.add_range(keys.begin(), keys.begin() + size);
+    }
+
+    template <size_t N>
+    void fill(FixedRecentlyUsedList<N>& rul, const vector<string>& keys, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+            rul.add(keys[i]);
+    }
+
+    template <typename List>
+    void run_scenarios(const char* name, size_t size, const vector<string>& keys, List& rul)
+    {
+        const size_t ops = operation_count(size);
+        const auto indexes = make_indexes(ops, size);
+
+        fill(rul, keys, size);
+        report("add-hit", name, size, ns_per_op(ops, [&](size_t i) { rul.add(keys[indexes[i]]); }));
+
+        report("add-miss-with-eviction", name, size, ns_per_op(ops, [&](size_t i) { rul.add(keys[size + i]); }));
+
+        const size_t passes = max<size_t>(1, 10'000'000 / size);
+        double ns_per_pass = ns_per_op(passes, [&](size_t) {
+            for (const auto& item : rul)
+                sink += item.size();
+        });
+        report("iteration (per item)", name, size, ns_per_pass / size);
+
+        report("indexed-access", name, size, ns_per_op(ops, [&](size_t i) { sink += rul[indexes[i]].size(); }));
+    }
+
+    template <size_t N>
+    void run_fixed(const vector<string>& keys, size_t max_size)
+    {
+        if (N > max_size)
+            return;
+
+        auto rul = make_unique<FixedRecentlyUsedList<N>>();
+        run_scenarios("FixedRecentlyUsedList<N>", N, keys, *rul);
+    }
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const size_t max_size = (argc > 1) ? strtoull(argv[1], nullptr, 10) : 1'000'000;
+
+    const vector<size_t> sizes = {8, 64, 256, 4'096, 65'536, 1'000'000};
+    const auto keys = make_keys(max_size + operation_count(1));
+
+    printf("%-24s %-28s %10s %14s\n", "scenario", "list", "size", "ns/op");
+
+    for (size_t size : sizes)
+    {
+        if (size > max_size)
+            break;
+
+        RecentlyUsedList rul(size);
+        run_scenarios("RecentlyUsedList", size, keys, rul);
+    }
+
+    run_fixed<8>(keys, max_size);
+    run_fixed<64>(keys, max_size);
+    run_fixed<256>(keys, max_size);
+
+    return sink == 0 ? 1 : 0;
+}
@@ -0,0 +1,233 @@
+#ifndef EXPIRING_RCL_HPP
+#define EXPIRING_RCL_HPP
+
+#include <chrono>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Recently used list whose items expire when they were not used for a given time.
+// The clock is a template parameter, so tests can control time with a fake clock.
+//
+// Every item has the same time-to-live counted from its last use, so the
+// recency order is also the expiry order: expired items are always at the back
+// and are dropped lazily before each access. Each item expires exactly once,
+// so the sweeps cost amortised O(1) per add() and need no timing wheel.
+//
+// Reads are const but drop expired items too, so even const members must not
+// be called concurrently on the same list.
+template <typename Clock = std::chrono::steady_clock>
+class ExpiringRecentlyUsedList
+{
+public:
+    using clock = Clock;
+    using duration = typename Clock::duration;
+    using time_point = typename Clock::time_point;
+
+private:
+    struct Entry
+    {
+        std::string item;
+        time_point last_used;
+    };
+
+    using Entries = std::list<Entry>;
+
+    mutable Entries items_;
+    mutable std::unordered_map<std::string_view, typename Entries::iterator> index_;
+    duration time_to_live_;
+    size_t capacity_;
+
+public:
+    class const_iterator
+    {
+        typename Entries::const_iterator it_;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = std::string;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string*;
+        using reference = const std::string&;
+
+        const_iterator() = default;
+
+        explicit const_iterator(typename Entries::const_iterator it)
+            : it_{it}
+        {
+        }
+
+        reference operator*() const
+        {
+            return it_->item;
+        }
+
+        pointer operator->() const
+        {
+            return &it_->item;
+        }
+
+        const_iterator& operator++()
+        {
+            ++it_;
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            return const_iterator{it_++};
+        }
+
+        const_iterator& operator--()
+        {
+            --it_;
+            return *this;
+        }
+
+        const_iterator operator--(int)
+        {
+            return const_iterator{it_--};
+        }
+
+        bool operator==(const const_iterator& other) const = default;
+    };
+
+    using value_type = std::string;
+    using iterator = const_iterator;
+
+    explicit ExpiringRecentlyUsedList(duration time_to_live, size_t capacity = std::numeric_limits<size_t>::max())
+        : time_to_live_{time_to_live}
+        , capacity_{capacity}
+    {
+    }
+
+    // the index refers to the items of its own list - a copy builds a new one
+    ExpiringRecentlyUsedList(const ExpiringRecentlyUsedList& other)
+        : items_{other.items_}
+        , time_to_live_{other.time_to_live_}
+        , capacity_{other.capacity_}
+    {
+        for (auto it = items_.begin(); it != items_.end(); ++it)
+            index_.emplace(it->item, it);
+    }
+
+    ExpiringRecentlyUsedList& operator=(const ExpiringRecentlyUsedList& other)
+    {
+        if (this != &other)
+            *this = ExpiringRecentlyUsedList{other};
+
+        return *this;
+    }
+
+    // nodes of the list are moved with their addresses, so the index stays valid
+    ExpiringRecentlyUsedList(ExpiringRecentlyUsedList&&) = default;
+    ExpiringRecentlyUsedList& operator=(ExpiringRecentlyUsedList&&) = default;
+
+    duration time_to_live() const
+    {
+        return time_to_live_;
+    }
+
+    size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    size_t size() const
+    {
+        remove_expired();
+        return items_.size();
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    void add(const std::string& item)
+    {
+        check_is_valid(item);
+
+        const time_point now = Clock::now();
+        remove_expired(now);
+
+        if (auto duplicate = index_.find(item); duplicate != index_.end())
+        {
+            auto duplicate_pos = duplicate->second;
+            duplicate_pos->last_used = now;
+            items_.splice(items_.begin(), items_, duplicate_pos);
+            return;
+        }
+
+        if (items_.size() == capacity_)
+            remove_back();
+
+        items_.push_front(Entry{item, now});
+        index_.emplace(items_.front().item, items_.begin());
+    }
+
+    bool contains(const std::string& item) const
+    {
+        remove_expired();
+        return index_.contains(item);
+    }
+
+    const std::string& front() const
+    {
+        remove_expired();
+        return items_.front().item;
+    }
+
+    const std::string& back() const
+    {
+        remove_expired();
+        return items_.back().item;
+    }
+
+    void clear()
+    {
+        index_.clear();
+        items_.clear();
+    }
+
+    const_iterator begin() const
+    {
+        remove_expired();
+        return const_iterator{items_.cbegin()};
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{items_.cend()};
+    }
+
+    void remove_expired() const
+    {
+        remove_expired(Clock::now());
+    }
+
+private:
+    void remove_expired(time_point now) const
+    {
+        while (!items_.empty() && now - items_.back().last_used >= time_to_live_)
+            remove_back();
+    }
+
+    void remove_back() const
+    {
+        index_.erase(items_.back().item);
+        items_.pop_back();
+    }
+
+    void check_is_valid(const std::string& item)
+    {
+        if (item.empty())
+            throw std::invalid_argument("empty string is not allowed");
+    }
+};
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef FIXED_RCL_HPP
+#define FIXED_RCL_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// Recently used list with a compile-time capacity.
+// Items are stored inline in fixed-length slots, so after construction
+// no operation allocates. Slots never move: recency is kept in a small
+// array of slot indexes and duplicates are found by comparing precomputed
+// item hashes (four at a time when SSE2 is available).
+template <size_t N, size_t MaxItemLength = 31>
+class FixedRecentlyUsedList
+{
+    static_assert(N > 0 && N <= 256, "capacity must be in range [1, 256]");
+    static_assert(MaxItemLength > 0 && MaxItemLength <= 255, "max item length must be in range [1, 255]");
+
+    using slot_index = std::uint8_t;
+
+    constexpr static size_t hash_lanes = 4;
+    constexpr static size_t padded_capacity = (N + hash_lanes - 1) / hash_lanes * hash_lanes;
+    constexpr static size_t npos = std::numeric_limits<size_t>::max();
+
+    struct Slot
+    {
+        std::uint8_t length;
+        std::array<char, MaxItemLength> chars;
+
+        std::string_view view() const
+        {
+            return {chars.data(), length};
+        }
+    };
+
+    alignas(16) std::array<std::uint32_t, padded_capacity> hashes_ = {};
+    std::array<Slot, N> slots_;
+    std::array<slot_index, N> order_ = {};
+    size_t size_ = 0;
+
+public:
+    class const_iterator
+    {
+        const FixedRecentlyUsedList* list_ = nullptr;
+        size_t index_ = 0;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::string_view;
+
+        const_iterator() = default;
+
+        const_iterator(const FixedRecentlyUsedList* list, size_t index)
+            : list_{list}
+            , index_{index}
+        {
+        }
+
+        std::string_view operator*() const
+        {
+            return (*list_)[index_];
+        }
+
+        const_iterator& operator++()
+        {
+            ++index_;
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto prev = *this;
+            ++index_;
+            return prev;
+        }
+
+        bool operator==(const const_iterator& other) const
+        {
+            return index_ == other.index_;
+        }
+    };
+
+    using value_type = std::string_view;
+    using iterator = const_iterator;
+
+    constexpr static size_t capacity()
+    {
+        return N;
+    }
+
+    constexpr static size_t max_item_length()
+    {
+        return MaxItemLength;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    void add(std::string_view item)
+    {
+        check_is_valid(item);
+
+        const std::uint32_t hash = hash_of(item);
+
+        if (size_t slot = find_slot(hash, item); slot != npos)
+        {
+            move_duplicate_to_front(slot);
+            return;
+        }
+
+        slot_index slot = (size_ == N) ? order_[N - 1] : static_cast<slot_index>(size_++);
+
+        hashes_[slot] = hash;
+        slots_[slot].length = static_cast<std::uint8_t>(item.size());
+        std::copy(item.begin(), item.end(), slots_[slot].chars.begin());
+
+        std::move_backward(order_.begin(), order_.begin() + size_ - 1, order_.begin() + size_);
+        order_[0] = slot;
+    }
+
+    std::string_view front() const
+    {
+        return (*this)[0];
+    }
+
+    std::string_view back() const
+    {
+        return (*this)[size_ - 1];
+    }
+
+    std::string_view operator[](size_t index) const
+    {
+        return slots_[order_[index]].view();
+    }
+
+    void clear()
+    {
+        size_ = 0;
+    }
+
+    const_iterator begin() const
+    {
+        return {this, 0};
+    }
+
+    const_iterator end() const
+    {
+        return {this, size_};
+    }
+
+private:
+    static std::uint32_t hash_of(std::string_view item)
+    {
+        // FNV-1a
+        std::uint32_t hash = 2166136261u;
+        for (unsigned char c : item)
+        {
+            hash ^= c;
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    size_t find_slot(std::uint32_t hash, std::string_view item) const
+    {
+#if defined(__SSE2__)
+        const __m128i needle = _mm_set1_epi32(static_cast<int>(hash));
+
+        for (size_t first = 0; first < size_; first += hash_lanes)
+        {
+            const __m128i block = _mm_load_si128(reinterpret_cast<const __m128i*>(&hashes_[first]));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle))));
+
+            if (size_ - first < hash_lanes)
+                mask &= (1u << (size_ - first)) - 1;
+
+            for (; mask != 0; mask &= mask - 1)
+            {
+                size_t slot = first + std::countr_zero(mask);
+                if (slots_[slot].view() == item)
+                    return slot;
+            }
+        }
+#else
+        for (size_t slot = 0; slot < size_; ++slot)
+        {
+            if (hashes_[slot] == hash && slots_[slot].view() == item)
+                return slot;
+        }
+#endif
+        return npos;
+    }
+
+    void move_duplicate_to_front(size_t slot)
+    {
+        auto duplicate_pos = std::find(order_.begin(), order_.begin() + size_, static_cast<slot_index>(slot));
+        std::rotate(order_.begin(), duplicate_pos, duplicate_pos + 1);
+    }
+
+    void check_is_valid(std::string_view item) const
+    {
+        if (item.empty())
+            throw std::invalid_argument("empty string is not allowed");
+
+        if (item.size() > MaxItemLength)
+            throw std::length_error("item is too long for a fixed recently used list");
+    }
+};
+
+#endif
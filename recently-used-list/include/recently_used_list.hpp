@@ -0,0 +1,161 @@
+#ifndef RUL_HPP
+#define RUL_HPP
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+class RecentlyUsedListSnapshot;
+
+class RecentlyUsedList
+{
+public:
+    using value_type = std::string;
+    using iterator = typename std::deque<std::string>::iterator;
+    using const_iterator = typename std::deque<std::string>::const_iterator;
+
+    explicit RecentlyUsedList(size_t capacity = std::numeric_limits<size_t>::max())
+        : capacity_{capacity}
+    {
+    }
+
+    size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    size_t size() const
+    {
+        return items_.size();
+    }
+
+    bool empty() const
+    {
+        return items_.empty();
+    }
+
+    void add(const std::string& item)
+    {
+        check_is_valid(item);
+
+        auto duplicate_pos = std::find(items_.begin(), items_.end(), item);
+
+        if (duplicate_pos != items_.end())
+            move_duplicate_to_front(duplicate_pos);
+        else
+        {
+            if (capacity_ == size())
+                items_.pop_back();
+            items_.push_front(item);
+        }
+    }
+
+    // Same final order as calling add() for each item in [first, last),
+    // but done in a single pass over the list
+    template <typename InputIt>
+    void add_range(InputIt first, InputIt last)
+    {
+        if constexpr (std::bidirectional_iterator<InputIt> && std::is_lvalue_reference_v<std::iter_reference_t<InputIt>>)
+        {
+            std::for_each(first, last, [this](const auto& item) { check_is_valid(item); });
+
+            add_most_recent_first(std::make_reverse_iterator(last), std::make_reverse_iterator(first));
+        }
+        else
+        {
+            std::vector<std::string> items(first, last);
+            add_range(items.begin(), items.end());
+        }
+    }
+
+    // Same final order as adding items of other from the least recent one
+    void merge(const RecentlyUsedList& other)
+    {
+        if (&other != this)
+            add_most_recent_first(other.items_.begin(), other.items_.end());
+    }
+
+    const std::string& front() const
+    {
+        return items_.front();
+    }
+
+    const std::string& back() const
+    {
+        return items_.back();
+    }
+
+    const std::string& operator[](size_t index) const
+    {
+        return items_[index];
+    }
+
+    void clear()
+    {
+        items_.clear();
+    }
+
+    const_iterator begin() const
+    {
+        return items_.begin();
+    }
+
+    const_iterator end() const
+    {
+        return items_.end();
+    }
+
+private:
+    friend class RecentlyUsedListSnapshot;
+
+    std::deque<std::string> items_;
+    size_t capacity_;
+
+    void move_duplicate_to_front(iterator duplicate_pos)
+    {
+        std::rotate(items_.begin(), duplicate_pos, duplicate_pos + 1);
+    }
+
+    // the range may refer to items of this list - it is read completely before items_ is changed,
+    // and added refers only to the copies in the new deque
+    template <typename Iterator>
+    void add_most_recent_first(Iterator first, Iterator last)
+    {
+        std::deque<std::string> items;
+        std::unordered_set<std::string_view> added;
+
+        for (; first != last && items.size() < capacity_; ++first)
+        {
+            std::string_view item{*first};
+
+            if (!added.contains(item))
+                added.insert(items.emplace_back(item));
+        }
+
+        for (auto& item : items_)
+        {
+            if (items.size() == capacity_)
+                break;
+
+            if (!added.contains(item))
+                items.push_back(std::move(item));
+        }
+
+        items_ = std::move(items);
+    }
+
+    void check_is_valid(std::string_view item)
+    {
+        if (item.empty())
+            throw std::invalid_argument("empty string is not allowed");
+    }
+};
+
+#endif
@@ -0,0 +1,245 @@
+#ifndef RCL_SNAPSHOT_HPP
+#define RCL_SNAPSHOT_HPP
+
+#include "recently_used_list.hpp"
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Binary layout (all integers little-endian):
+//   snapshot: "RULS" | u32 version | u64 capacity | u64 count | count * (u32 length | bytes)
+//   journal:  "RULJ" | u32 version | n * (u32 length | bytes)
+namespace RulBinaryFormat
+{
+    constexpr std::uint32_t version = 1;
+    constexpr std::string_view snapshot_magic = "RULS";
+    constexpr std::string_view journal_magic = "RULJ";
+    constexpr size_t header_size = 8;
+
+    template <typename T>
+    void write(std::ostream& out, T value)
+    {
+        std::array<char, sizeof(T)> bytes;
+        for (size_t i = 0; i < sizeof(T); ++i)
+            bytes[i] = static_cast<char>((value >> (8 * i)) & 0xFF);
+        out.write(bytes.data(), bytes.size());
+    }
+
+    inline void write_header(std::ostream& out, std::string_view magic)
+    {
+        out.write(magic.data(), magic.size());
+        write(out, version);
+    }
+
+    inline void write_item(std::ostream& out, const std::string& item)
+    {
+        write(out, static_cast<std::uint32_t>(item.size()));
+        out.write(item.data(), item.size());
+    }
+
+    // Sequential reader over a contiguous buffer, e.g. a memory mapped file
+    class BufferReader
+    {
+        std::string_view buffer_;
+        size_t pos_ = 0;
+
+    public:
+        explicit BufferReader(std::string_view buffer)
+            : buffer_{buffer}
+        {
+        }
+
+        size_t remaining() const
+        {
+            return buffer_.size() - pos_;
+        }
+
+        template <typename T>
+        T read()
+        {
+            std::string_view bytes = read_bytes(sizeof(T));
+
+            T value{};
+            for (size_t i = 0; i < sizeof(T); ++i)
+                value |= static_cast<T>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+            return value;
+        }
+
+        std::string_view read_bytes(size_t count)
+        {
+            if (count > remaining())
+                throw std::runtime_error("unexpected end of recently used list data");
+
+            std::string_view bytes = buffer_.substr(pos_, count);
+            pos_ += count;
+            return bytes;
+        }
+
+        void read_header(std::string_view magic)
+        {
+            if (remaining() < header_size || read_bytes(magic.size()) != magic)
+                throw std::runtime_error("invalid recently used list data header");
+
+            if (read<std::uint32_t>() != version)
+                throw std::runtime_error("unsupported recently used list data version");
+        }
+    };
+} // namespace RulBinaryFormat
+
+class RecentlyUsedListSnapshot
+{
+public:
+    static void save(const RecentlyUsedList& rul, std::ostream& out)
+    {
+        using namespace RulBinaryFormat;
+
+        write_header(out, snapshot_magic);
+        write(out, static_cast<std::uint64_t>(rul.capacity()));
+        write(out, static_cast<std::uint64_t>(rul.size()));
+
+        for (const auto& item : rul)
+            write_item(out, item);
+    }
+
+    static RecentlyUsedList load(std::istream& in)
+    {
+        std::string buffer{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+
+        return load(std::string_view{buffer});
+    }
+
+    // Items are trusted to be unique (as written by save()),
+    // so the list is rebuilt in a single pass without duplicate lookups
+    static RecentlyUsedList load(std::string_view buffer)
+    {
+        RulBinaryFormat::BufferReader reader{buffer};
+        reader.read_header(RulBinaryFormat::snapshot_magic);
+
+        auto capacity = reader.read<std::uint64_t>();
+        auto count = reader.read<std::uint64_t>();
+
+        if (count > capacity)
+            throw std::runtime_error("recently used list snapshot exceeds its capacity");
+
+        RecentlyUsedList rul(static_cast<size_t>(capacity));
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            std::string_view item = reader.read_bytes(reader.read<std::uint32_t>());
+
+            if (item.empty())
+                throw std::runtime_error("recently used list snapshot contains an empty item");
+
+            rul.items_.emplace_back(item);
+        }
+
+        return rul;
+    }
+
+    static RecentlyUsedList load_file(const std::string& path)
+    {
+#if __has_include(<sys/mman.h>)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            throw std::runtime_error("cannot open recently used list snapshot: " + path);
+
+        struct stat file_stat{};
+        if (::fstat(fd, &file_stat) == -1 || file_stat.st_size == 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("cannot read recently used list snapshot: " + path);
+        }
+
+        size_t file_size = static_cast<size_t>(file_stat.st_size);
+        void* data = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+            throw std::runtime_error("cannot map recently used list snapshot: " + path);
+
+        ::madvise(data, file_size, MADV_SEQUENTIAL);
+
+        try
+        {
+            auto rul = load(std::string_view{static_cast<const char*>(data), file_size});
+            ::munmap(data, file_size);
+            return rul;
+        }
+        catch (...)
+        {
+            ::munmap(data, file_size);
+            throw;
+        }
+#else
+        std::ifstream in{path, std::ios::binary};
+        if (!in)
+            throw std::runtime_error("cannot open recently used list snapshot: " + path);
+
+        return load(in);
+#endif
+    }
+};
+
+// Append-only log of add() calls made since the last snapshot.
+// Start a new journal whenever a snapshot is saved.
+class RecentlyUsedListJournal
+{
+    std::ostream& out_;
+
+public:
+    explicit RecentlyUsedListJournal(std::ostream& out)
+        : out_{out}
+    {
+        RulBinaryFormat::write_header(out_, RulBinaryFormat::journal_magic);
+    }
+
+    void add(RecentlyUsedList& rul, const std::string& item)
+    {
+        rul.add(item);
+        RulBinaryFormat::write_item(out_, item);
+    }
+
+    void flush()
+    {
+        out_.flush();
+    }
+
+    // A record torn by a crash at the end of the journal is ignored
+    static void replay(std::string_view journal, RecentlyUsedList& rul)
+    {
+        RulBinaryFormat::BufferReader reader{journal};
+        reader.read_header(RulBinaryFormat::journal_magic);
+
+        while (reader.remaining() >= sizeof(std::uint32_t))
+        {
+            auto length = reader.read<std::uint32_t>();
+            if (length > reader.remaining())
+                break;
+
+            rul.add(std::string{reader.read_bytes(length)});
+        }
+    }
+
+    static void replay(std::istream& in, RecentlyUsedList& rul)
+    {
+        std::string journal{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+
+        replay(std::string_view{journal}, rul);
+    }
+};
+
+#endif